@@ -50,6 +50,9 @@
  *  The last thing is to override any other settings via the command-line
  *  parameters.
  *
+ *  If "-o bounce=filename" was given, clinsmanager::run() renders the song
+ *  to that file and returns, and the application is not daemonized.
+ *
  * Daemon support:
  *
  *  Apart from the usual daemon stuff, we need to handle the following issues:
@@ -92,10 +95,11 @@ main (int argc, char * argv [])
     }
 
     bool result = sm.create(argc, argv);
+    bool bouncing = ! seq66::usr().option_bounce().empty();
     if (result)
     {
 #if defined SEQ66_PLATFORM_LINUX
-        if (seq66::usr().option_daemonize())
+        if (seq66::usr().option_daemonize() && ! bouncing)
         {
             seq66::set_app_type("daemon");
             seq66::set_app_name("seq66daemon");
@@ -113,7 +117,7 @@ main (int argc, char * argv [])
         exit_status = EXIT_FAILURE;
 
 #if defined SEQ66_PLATFORM_LINUX
-    if (seq66::usr().option_daemonize())
+    if (seq66::usr().option_daemonize() && ! bouncing)
         seq66::undaemonize(usermask);
 #endif
 
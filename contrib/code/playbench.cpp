@@ -0,0 +1,412 @@
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          playbench.cpp
+ *
+ *  A micro-benchmark of the playback engine, using synthetic songs.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  Builds songs of N patterns, each with M notes and K song triggers, at a
+ *  couple of PPQN values, and times:
+ *
+ *      -   sort: eventlist::sort() via sequence::sort_events().
+ *      -   link: eventlist::link_new() via sequence::verify_and_link().
+ *      -   live: sequence::play() in Live mode, via performer::play(), with
+ *          the master buss capturing the events (see mastermidibase::
+ *          capture()) instead of sending them.
+ *      -   song: triggers::play() plus sequence::play(), via
+ *          performer::render_song().
+ *      -   capture: mastermidibase::play() of one event in capture mode,
+ *          which stops at the capture hook, so this is the cost of reaching
+ *          the buss, not of sending to a port.
+ *      -   dispatch: mastermidibase::play() with capture off, which goes
+ *          through busarray::play() and the midibus to the port of the null
+ *          MIDI API (midi_null::api_play()), which logs the event.
+ *      -   parse and write: midifile reading and writing of each MIDI file
+ *          in a directory, such as contrib/midi.
+ *
+ *  The results are written to standard output as CSV, one line per
+ *  measurement, so that runs can be compared from release to release:
+ *
+ *      bench,ppqn,patterns,notes,triggers,items,us,ns_per_item
+ *
+ *  where "items" is what was counted (events sorted or linked, ticks played,
+ *  events captured or dispatched, or bytes parsed or written).
+ *
+ *  The live, song, capture, and dispatch benchmarks need a master buss, so the
+ *  performer is launched.  It uses the null MIDI API, so the program runs
+ *  headless, with no ALSA or JACK server.  If the launch fails, those
+ *  benchmarks are skipped.  See the make_playbench script for building this
+ *  program.
+ *
+ *  Usage:
+ *
+ *      playbench [ iterations [ mididirectory ] ]
+ */
+
+#include <cstdio>                       /* std::printf()                    */
+#include <cstdlib>                      /* std::atoi(), EXIT_SUCCESS        */
+#include <fstream>                      /* std::ifstream                    */
+#include <iostream>                     /* std::cerr                        */
+#include <string>                       /* std::string                      */
+#include <vector>                       /* std::vector<>                    */
+
+#include "cfg/settings.hpp"             /* seq66::rc() and seq66::usr()     */
+#include "midi/midifile.hpp"            /* seq66::midifile                  */
+#include "os/timing.hpp"                /* seq66::microtime()               */
+#include "play/performer.hpp"           /* seq66::performer                 */
+#include "play/sequence.hpp"            /* seq66::sequence                  */
+#include "util/filefunctions.hpp"       /* seq66::file_extension() etc.     */
+
+#if defined SEQ66_PLATFORM_UNIX
+#include <dirent.h>                     /* opendir(), readdir()             */
+#endif
+
+/**
+ *  One synthetic workload.
+ */
+
+struct workload
+{
+    int wl_ppqn;
+    int wl_patterns;
+    int wl_notes;
+    int wl_triggers;
+};
+
+/**
+ *  The workloads timed.  The pattern length is one measure of 4/4.  Keep
+ *  the larger ones modest; the song benchmark plays every pulse.
+ */
+
+static const workload s_workloads [] =
+{
+    {  192,  8,  32,  4 },
+    {  192,  8, 256,  4 },
+    {  192, 32,  32, 16 },
+    {  192, 32, 256, 16 },
+    {  960,  8,  32,  4 },
+    {  960,  8, 256,  4 },
+    {  960, 32,  32, 16 },
+    {  960, 32, 256, 16 },
+};
+
+static void
+report
+(
+    const std::string & bench, const workload & w,
+    long items, long us
+)
+{
+    double nsper = items > 0 ? us * 1000.0 / double(items) : 0.0 ;
+    std::printf
+    (
+        "%s,%d,%d,%d,%d,%ld,%ld,%.1f\n", bench.c_str(),
+        w.wl_ppqn, w.wl_patterns, w.wl_notes, w.wl_triggers, items, us, nsper
+    );
+}
+
+/**
+ *  Fills a pattern with evenly-spaced notes, appended in reverse order so
+ *  that the sort has some work to do.
+ */
+
+static void
+fill_pattern (seq66::sequence & s, int notes, seq66::midipulse length)
+{
+    seq66::midipulse step = length / notes;
+    if (step < 2)
+        step = 2;
+
+    for (int n = notes - 1; n >= 0; --n)
+    {
+        seq66::midipulse tick = n * step;
+        int note = 36 + n % 48;
+        seq66::event on(tick, seq66::EVENT_NOTE_ON, 0, note, 100);
+        seq66::event off(tick + step / 2, seq66::EVENT_NOTE_OFF, 0, note, 0);
+        (void) s.append_event(off);
+        (void) s.append_event(on);
+    }
+}
+
+/**
+ *  Times the sorting and linking of the events of scratch patterns.
+ */
+
+static void
+bench_events (const workload & w, int iterations)
+{
+    seq66::midipulse length = w.wl_ppqn * 4;
+    long sortus = 0;
+    long linkus = 0;
+    long count = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (int p = 0; p < w.wl_patterns; ++p)
+        {
+            seq66::sequence s(w.wl_ppqn);
+            (void) s.set_length(length, false, false);
+            fill_pattern(s, w.wl_notes, length);
+
+            long t0 = seq66::microtime();
+            s.sort_events();
+
+            long t1 = seq66::microtime();
+            s.verify_and_link();
+
+            long t2 = seq66::microtime();
+            sortus += t1 - t0;
+            linkus += t2 - t1;
+            count += s.event_count();
+        }
+    }
+    report("sort", w, count, sortus);
+    report("link", w, count, linkus);
+}
+
+/**
+ *  Creates the patterns of a workload in the performer, each with triggers
+ *  laid end to end.
+ */
+
+static bool
+build_song (seq66::performer & p, const workload & w)
+{
+    seq66::midipulse length = w.wl_ppqn * 4;
+    bool result = p.clear_all();
+    for (int n = 0; result && n < w.wl_patterns; ++n)
+    {
+        seq66::seq::number seqno;
+        result = p.new_sequence(seqno, n);
+        if (result)
+        {
+            seq66::seq::pointer s = p.get_sequence(seqno);
+            (void) s->set_length(length);
+            fill_pattern(*s, w.wl_notes, length);
+            s->verify_and_link();
+            for (int t = 0; t < w.wl_triggers; ++t)
+                (void) s->add_trigger(t * length, length);
+        }
+    }
+    return result;
+}
+
+/**
+ *  Times the engine on the song of a workload:  Live-mode playback of the
+ *  armed patterns, Song-mode rendering, and the capture and the dispatch of
+ *  single events by the master buss.
+ */
+
+static void
+bench_engine (seq66::performer & p, const workload & w, int iterations)
+{
+    if (! build_song(p, w))
+    {
+        std::cerr << "# could not build song" << std::endl;
+        return;
+    }
+
+    seq66::mastermidibus * mmb = p.master_bus();
+    seq66::midipulse endtick = w.wl_ppqn * 4 * w.wl_triggers;
+    long liveus = 0;
+    long songus = 0;
+    long livecount = 0;
+    long songcount = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        p.song_mode(false);
+        for (int n = 0; n < w.wl_patterns; ++n)
+            (void) p.get_sequence(n)->set_armed(true);
+
+        mmb->capture(true);
+        p.set_tick(0);
+        p.set_last_ticks(0);
+
+        long t0 = seq66::microtime();
+        for (seq66::midipulse tick = 0; tick < endtick; ++tick)
+        {
+            mmb->capture_tick(tick);
+            p.play(tick);
+        }
+        liveus += seq66::microtime() - t0;
+        livecount += endtick;
+        mmb->capture(false);
+        p.off_sequences();                      /* render_song() resets     */
+
+        seq66::midipulse songend = 0;
+        long t1 = seq66::microtime();
+        if (p.render_song(songend))
+        {
+            songus += seq66::microtime() - t1;
+            songcount += songend;
+        }
+    }
+    report("live", w, livecount, liveus);
+    report("song", w, songcount, songus);
+
+    seq66::event ev(0, seq66::EVENT_NOTE_ON, 0, 60, 100);
+    long captures = long(w.wl_patterns) * w.wl_notes * iterations;
+    mmb->capture(true);
+
+    long t2 = seq66::microtime();
+    for (long c = 0; c < captures; ++c)
+        mmb->play(0, &ev, 0);
+
+    long captureus = seq66::microtime() - t2;
+    mmb->capture(false);
+    report("capture", w, captures, captureus);
+
+    /*
+     * Alternate Note Ons and Note Offs, so that the note tracking of the
+     * master buss stays balanced, as it does in playback.
+     */
+
+    if (mmb->get_num_out_buses() == 0)
+    {
+        std::cerr << "# no output buss, dispatch skipped" << std::endl;
+        return;
+    }
+
+    seq66::event evoff(0, seq66::EVENT_NOTE_OFF, 0, 60, 0);
+    unsigned long played = mmb->events_played();
+    long t3 = seq66::microtime();
+    for (long c = 0; c < captures; ++c)
+        mmb->play(0, (c & 1) ? &evoff : &ev, 0);
+
+    long dispatchus = seq66::microtime() - t3;
+    long dispatched = long(mmb->events_played() - played);
+    report("dispatch", w, dispatched, dispatchus);
+}
+
+static long
+file_bytes (const std::string & fname)
+{
+    std::ifstream f(fname, std::ios::binary | std::ios::ate);
+    return f.is_open() ? long(f.tellg()) : 0 ;
+}
+
+/**
+ *  Times the parsing and writing of each MIDI file in a directory.  The
+ *  "workload" fields are zero except for the PPQN of the file.
+ */
+
+static void
+bench_files (seq66::performer & p, const std::string & dir, int iterations)
+{
+#if defined SEQ66_PLATFORM_UNIX
+    DIR * d = opendir(dir.c_str());
+    if (d == nullptr)
+    {
+        std::cerr << "# cannot open " << dir << std::endl;
+        return;
+    }
+
+    std::vector<std::string> files;
+    for (struct dirent * e = readdir(d); e != nullptr; e = readdir(d))
+    {
+        std::string name = e->d_name;
+        std::string ext = seq66::file_extension(name);
+        if (ext == "mid" || ext == "midi")
+            files.push_back(seq66::pathname_concatenate(dir, name));
+    }
+    closedir(d);
+
+    std::string scratch = "/tmp/playbench.midi";
+    for (const auto & fname : files)
+    {
+        long bytes = file_bytes(fname);
+        long parseus = 0;
+        long writeus = 0;
+        long parsed = 0;
+        long written = 0;
+        workload w = { 0, 0, 0, 0 };
+        for (int i = 0; i < iterations; ++i)
+        {
+            (void) p.clear_all();
+
+            seq66::midifile rf(fname, p.ppqn());
+            long t0 = seq66::microtime();
+            bool ok = rf.parse(p);
+            parseus += seq66::microtime() - t0;
+            if (! ok)
+                break;
+
+            parsed += bytes;
+            w.wl_ppqn = p.ppqn();
+
+            seq66::midifile wf(scratch, p.ppqn());
+            long t1 = seq66::microtime();
+            ok = wf.write(p);
+            writeus += seq66::microtime() - t1;
+            if (ok)
+                written += file_bytes(scratch);
+        }
+        std::string base = seq66::filename_base(fname);
+        report("parse:" + base, w, parsed, parseus);
+        report("write:" + base, w, written, writeus);
+    }
+    (void) seq66::file_delete(scratch);
+#else
+    (void) p;
+    (void) iterations;
+    std::cerr << "# file benchmarks not supported: " << dir << std::endl;
+#endif
+}
+
+int
+main (int argc, char * argv [])
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 4 ;
+    std::string mididir = argc > 2 ? argv[2] : "contrib/midi" ;
+    if (iterations < 1)
+        iterations = 1;
+
+    seq66::rc().with_null_midi(true);           /* no ALSA or JACK needed   */
+    std::printf("bench,ppqn,patterns,notes,triggers,items,us,ns_per_item\n");
+    for (const auto & w : s_workloads)
+        bench_events(w, iterations);
+
+    seq66::performer p(seq66::usr().midi_ppqn(), 4, 8);
+    if (p.launch(seq66::usr().midi_ppqn()))
+    {
+        for (const auto & w : s_workloads)
+        {
+            (void) p.change_ppqn(w.wl_ppqn);
+            bench_engine(p, w, iterations);
+        }
+        bench_files(p, mididir, iterations);
+        (void) p.finish();
+    }
+    else
+        std::cerr << "# launch failed, skipping engine benchmarks" << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+/*
+ * playbench.cpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -225,6 +225,9 @@
 #define SEQ66_LIBLO_SUPPORT 1
 #endif
 
+/* Define to enable mutex contention profiling */
+/* #undef LOCK_PROFILE */
+
 /* Define to the sub-directory where libtool stores uninstalled libraries. */
 #ifndef SEQ66_LT_OBJDIR
 #define SEQ66_LT_OBJDIR ".libs/"
@@ -352,6 +352,13 @@
 #define SEQ66_NSM_SUPPORT 1
 #endif
 
+/*
+ * Define to enable mutex contention profiling.  For qmake, this is done by
+ * "qmake CONFIG+=lock_profile"; see libseq66.pro.
+ */
+
+#undef LOCK_PROFILE
+
 /*
  * Define to the sub-directory where libtool stores uninstalled libraries.
  * Useless for qmake, but keep it for now.
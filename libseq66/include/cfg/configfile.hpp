@@ -37,6 +37,7 @@
 
 #include <fstream>                      /* std::streampos                   */
 #include <string>                       /* std::string, the ubiquitous one  */
+#include <vector>                       /* std::vector<> for section index  */
 
 #include "util/basic_macros.hpp"        /* seq66::tokenization vector       */
 #include "util/strfunctions.hpp"        /* seq66::string_to_int()           */
@@ -159,6 +160,41 @@ private:
 
     std::string m_file_version;
 
+    /**
+     *  An entry in the index of section markers, built by index_sections().
+     */
+
+    struct section_mark
+    {
+        std::string sm_tag;             /**< The trimmed "[section]" line.  */
+        std::streampos sm_pos;          /**< Stream position of the line.   */
+        int sm_line_number;             /**< Line number of the line.       */
+    };
+
+    /**
+     *  The section markers of the file being parsed, in file order.  With
+     *  this index, line_after(), next_section(), and find_tag() seek
+     *  directly to a section instead of reading every line before it.
+     */
+
+    std::vector<section_mark> m_sections;
+
+    /**
+     *  The stream to which m_sections applies.  Other streams are scanned
+     *  line by line, as before.  Reset by clear_index() when parsing ends,
+     *  since the stream is normally on the stack of the parse() function,
+     *  and a later stream could get the same address.
+     */
+
+    const std::ifstream * m_index_stream;
+
+    /**
+     *  The number of lines in the indexed stream, the line number a scan
+     *  that fails to find a section would end at.
+     */
+
+    int m_index_line_count;
+
 protected:
 
     /**
@@ -346,6 +382,53 @@ protected:
         return m_line.c_str();
     }
 
+    /**
+     *  Indexes a stream for the life of a parsing function, and drops the
+     *  index when that function returns, however it returns.
+     */
+
+    class index_guard
+    {
+        configfile & m_config;
+
+    public:
+
+        index_guard (configfile & cfg, std::ifstream & file) :
+            m_config    (cfg)
+        {
+            (void) m_config.index_sections(file);
+        }
+
+        ~index_guard ()
+        {
+            m_config.clear_index();
+        }
+    };
+
+    bool index_sections (std::ifstream & file);
+    void clear_index ();
+    int index_line_number
+    (
+        const std::ifstream & file,
+        std::streampos pos
+    ) const;
+    bool seek_section
+    (
+        std::ifstream & file,
+        const std::string & tag,
+        std::streampos from
+    );
+
+    /**
+     *  Indicates if a tag can be looked up in the section index.  Only tags
+     *  starting with a bracket can match a section-marker line.
+     */
+
+    bool use_index (const std::ifstream & file, const std::string & tag) const
+    {
+        return &file == m_index_stream && ! tag.empty() && tag[0] == '[';
+    }
+
     bool get_line (std::ifstream & file, bool strip = true);
     bool line_after
     (
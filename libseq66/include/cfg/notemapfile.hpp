@@ -105,6 +105,12 @@ extern bool copy_notemapper
     const std::string & source,
     const std::string & destination
 );
+extern bool read_notemapper
+(
+    notemapper & nm,
+    const std::string & source,
+    std::string & errmsg
+);
 
 }               // namespace seq66
 
@@ -35,6 +35,7 @@
  *  accessible from the command-line or from the 'rc' file.
  */
 
+#include <map>                          /* std::map<bussbyte, latency>      */
 #include <string>
 
 #include "cfg/basesettings.hpp"         /* seq66::basesettings class        */
@@ -42,6 +43,7 @@
 #include "ctrl/keycontainer.hpp"        /* seq66::keycontainer class        */
 #include "ctrl/midicontrolin.hpp"       /* seq66::midicontrolin class       */
 #include "ctrl/midicontrolout.hpp"      /* seq66::midicontrolout class      */
+#include "midi/midithru.hpp"            /* seq66::midithru::routes          */
 #include "play/clockslist.hpp"          /* list of seq66::e_clock settings  */
 #include "play/inputslist.hpp"          /* list of boolean input settings   */
 #include "play/metro.hpp"               /* seq66::metrosettings class       */
@@ -187,6 +189,22 @@ private:
 
     inputslist m_inputs;
 
+    /**
+     *  The optional input-latency offset of each input bus, in microseconds.
+     *  It is subtracted from the tick at which an incoming event is
+     *  recorded, in addition to the age of the event reported by the input
+     *  API.  Buses not in the map have no offset.
+     */
+
+    std::map<bussbyte, int> m_input_latencies;
+
+    /**
+     *  The direct thru routes, from an input buss (and channel) to an output
+     *  buss (and channel).  See the midithru class.
+     */
+
+    midithru::routes m_thru_routes;
+
     /**
      *  Settings for the metronome.
      */
@@ -271,6 +289,7 @@ private:
     bool m_with_jack_midi;          /**< Use JACK MIDI.                     */
     bool m_jack_auto_connect;       /**< Connect JACK ports in normal mode. */
     bool m_jack_use_offset;         /**< Try to calculate output offset.    */
+    bool m_jack_cycle_sync;         /**< Pace output by the JACK cycle.     */
     int m_jack_buffer_size;         /**< The desired power-of-2 size, or 0. */
     sequence::playback m_song_start_mode; /**< Song mode versus Live mode.  */
     bool m_song_start_is_auto;      /**< True if "auto" read from 'rc'.     */
@@ -278,7 +297,12 @@ private:
     bool m_manual_ports;            /**< [manual-ports] setting.            */
     int m_manual_port_count;        /**< [manual-ports] outputjport count.  */
     int m_manual_in_port_count;     /**< [manual-ports] inputjport count.   */
+    bool m_with_null_midi;          /**< [manual-ports] Use null MIDI API.  */
+    std::string m_null_midi_script; /**< [manual-ports] Null input script.  */
+    std::string m_null_midi_log;    /**< [manual-ports] Null output log.    */
     bool m_reveal_ports;            /**< [reveal-ports] setting.            */
+    bool m_panic_channel_mode;      /**< [midi-panic] send CC 120 & 123.    */
+    int m_panic_rate;               /**< [midi-panic] messages/s per buss.  */
     bool m_init_disabled_ports;     /**< A new test option. EXPERIMENTAL.   */
     bool m_print_keys;              /**< Show hot-key in main window slot.  */
     interaction m_interaction_method; /**< Interaction method: no support.  */
@@ -567,6 +591,35 @@ public:
         return m_inputs;
     }
 
+    const std::map<bussbyte, int> & input_latencies () const
+    {
+        return m_input_latencies;
+    }
+
+    int input_latency_us (bussbyte bus) const
+    {
+        auto it = m_input_latencies.find(bus);
+        return it != m_input_latencies.end() ? it->second : 0 ;
+    }
+
+    void input_latency_us (bussbyte bus, int us)
+    {
+        if (us != 0)
+            m_input_latencies[bus] = us;
+        else
+            (void) m_input_latencies.erase(bus);
+    }
+
+    const midithru::routes & thru_routes () const
+    {
+        return m_thru_routes;
+    }
+
+    void add_thru_route (const midithru::route & r)
+    {
+        m_thru_routes.push_back(r);
+    }
+
     metrosettings & metro_settings ()
     {
         return m_metro_settings;
@@ -764,6 +817,11 @@ public:
         return m_jack_use_offset;
     }
 
+    bool jack_cycle_sync () const
+    {
+        return m_jack_cycle_sync;
+    }
+
     int jack_buffer_size () const
     {
         return m_jack_buffer_size;
@@ -826,6 +884,11 @@ public:
         m_jack_use_offset = flag;
     }
 
+    void jack_cycle_sync (bool flag)
+    {
+        m_jack_cycle_sync = flag;
+    }
+
     /*
      * This check is the same as is_power_of_2() in the calculations module.
      */
@@ -871,11 +934,36 @@ public:
         return m_manual_in_port_count;
     }
 
+    bool with_null_midi () const
+    {
+        return m_with_null_midi;
+    }
+
+    const std::string & null_midi_script () const
+    {
+        return m_null_midi_script;
+    }
+
+    const std::string & null_midi_log () const
+    {
+        return m_null_midi_log;
+    }
+
     bool reveal_ports () const
     {
         return m_reveal_ports;
     }
 
+    bool panic_channel_mode () const
+    {
+        return m_panic_channel_mode;
+    }
+
+    int panic_rate () const
+    {
+        return m_panic_rate;
+    }
+
     bool init_disabled_ports () const
     {
         return m_init_disabled_ports;
@@ -1293,11 +1381,36 @@ public:
         m_manual_in_port_count = count;
     }
 
+    void with_null_midi (bool flag)
+    {
+        m_with_null_midi = flag;
+    }
+
+    void null_midi_script (const std::string & fname)
+    {
+        m_null_midi_script = fname;
+    }
+
+    void null_midi_log (const std::string & fname)
+    {
+        m_null_midi_log = fname;
+    }
+
     void reveal_ports (bool flag)
     {
         m_reveal_ports = flag;
     }
 
+    void panic_channel_mode (bool flag)
+    {
+        m_panic_channel_mode = flag;
+    }
+
+    void panic_rate (int rate)
+    {
+        m_panic_rate = rate >= 0 ? rate : 0 ;
+    }
+
     void init_disabled_ports (bool flag)
     {
         m_init_disabled_ports = flag;
@@ -760,6 +760,14 @@ private:
 
     std::string m_user_option_logfile;
 
+    /**
+     *  If not empty, seq66cli renders the song, faster than real time, to
+     *  this MIDI file, and exits, instead of running.  Specified by the
+     *  "-o bounce=filename" option, and never saved.
+     */
+
+    std::string m_user_option_bounce;
+
     /**
      *  The full path to PDF and browser executables, in case the system
      *  defaults are not present or are not suitable.
@@ -1496,6 +1504,11 @@ public:
         return m_user_option_logfile;
     }
 
+    const std::string & option_bounce () const
+    {
+        return m_user_option_bounce;
+    }
+
     const std::string & user_pdf_viewer () const
     {
         return m_user_pdf_viewer;
@@ -1778,6 +1791,11 @@ public:         // used in main application module and the usrfile class
 
     void option_logfile (const std::string & file);
 
+    void option_bounce (const std::string & file)
+    {
+        m_user_option_bounce = file;
+    }
+
     /*
      *  Since these a paths to executable, probably good to provide a full
      *  path, for now we will not enforce that.
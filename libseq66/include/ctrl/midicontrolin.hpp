@@ -39,6 +39,7 @@
 
 #include <map>                          /* std::map<> and multimap<>        */
 #include <string>                       /* std::string                      */
+#include <vector>                       /* std::vector<> dispatch table     */
 
 #include "cfg/comments.hpp"             /* seq66::comments class            */
 #include "ctrl/midicontrol.hpp"         /* seq66::midicontrol event item    */
@@ -83,6 +84,24 @@ private:
 
     mccontainer m_container;
 
+    /**
+     *  Provides a direct lookup of the control matching an incoming channel
+     *  message, indexed by status byte (0x80 to 0xEF, channel included) and
+     *  d0, so that control() need not search the multimap for every event.
+     *  Each entry is 1 + the index of the control in m_dispatch_controls, or
+     *  0 if no control matches.  Built by add() and emptied by clear().
+     *  Indices (not pointers into m_container) keep the default copy safe.
+     */
+
+    std::vector<unsigned short> m_dispatch_table;
+
+    /**
+     *  Copies of the controls referenced by m_dispatch_table, the first one
+     *  added for each key, which is the one that the multimap lookup finds.
+     */
+
+    std::vector<midicontrol> m_dispatch_controls;
+
     /**
      *  Provides the text of a "[comments]" section of the MIDI control "ctrl"
      *  file.  It can, for example, note the device for which the controls
@@ -139,6 +158,8 @@ public:
     void clear ()
     {
         m_container.clear();
+        m_dispatch_table.clear();
+        m_dispatch_controls.clear();
     }
 
     int count () const
@@ -38,6 +38,8 @@
  *
  */
 
+#include <atomic>                       /* std::atomic<bool> pending flag   */
+#include <mutex>                        /* std::mutex for the feedback      */
 #include <vector>                       /* std::vector<>                    */
 
 #include "ctrl/midicontrolbase.hpp"     /* seq66::midicontrolbase class     */
@@ -239,6 +241,50 @@ private:
 
     using uiactionlist = std::vector<uiactions>;
 
+    /**
+     *  The differential feedback (LED) engine.  Status events are not sent
+     *  as they are requested; instead, each is posted as the wanted state of
+     *  its "address" (the message type, channel, and d0, with Note On and
+     *  Note Off sharing an address), replacing any state still pending
+     *  there.  take() then yields only the addresses whose wanted state
+     *  differs from the shadow of the last state sent.  A full-grid refresh
+     *  thus costs only the buttons that actually change.  The state of an
+     *  address is the status byte and d1.
+     *
+     *  The object can be copied along with its midicontrolout; the mutex is
+     *  not copied.
+     */
+
+    class feedback
+    {
+
+    private:
+
+        std::vector<unsigned short> m_shadow;   /**< Last sent, 0 = none.   */
+        std::vector<unsigned short> m_wanted;   /**< Latest requested.      */
+        std::vector<unsigned short> m_dirty;    /**< Addresses to check.    */
+        std::vector<bool> m_queued;             /**< Address is in m_dirty. */
+        std::atomic<bool> m_pending;            /**< True if m_dirty used.  */
+        mutable std::mutex m_mutex;             /**< Callers vary threads.  */
+
+    public:
+
+        feedback ();
+        feedback (const feedback & rhs);
+        feedback & operator = (const feedback & rhs);
+        ~feedback () = default;
+
+        bool pending () const
+        {
+            return m_pending;
+        }
+
+        bool post (const event & ev);
+        int take (std::vector<event> & evs, int limit);
+        void forget ();
+
+    };
+
 private:
 
     /**
@@ -284,6 +330,29 @@ private:
 
     int m_screenset_size;
 
+    /**
+     *  Holds the status events waiting to be sent, and the device state
+     *  already sent.  See send_feedback().
+     */
+
+    feedback m_feedback;
+
+    /**
+     *  An optional limit on the number of status messages per second sent to
+     *  the device, for controllers with small input buffers.  0 means no
+     *  limit.  Read from the 'ctrl' file.
+     */
+
+    int m_feedback_rate;
+
+    /**
+     *  The number of messages that can be sent now under m_feedback_rate,
+     *  and the time (microseconds) at which it was last replenished.
+     */
+
+    double m_feedback_budget;
+    long m_feedback_time;
+
 public:
 
     midicontrolout (const std::string & name);
@@ -308,6 +377,23 @@ public:
         return m_screenset_size;
     }
 
+    int feedback_rate () const
+    {
+        return m_feedback_rate;
+    }
+
+    void feedback_rate (int rate)
+    {
+        m_feedback_rate = rate > 0 ? rate : 0;
+    }
+
+    bool feedback_pending () const
+    {
+        return m_feedback.pending();
+    }
+
+    void send_feedback (bool unlimited = false);
+
     void send_seq_event (int seq, seqaction what, bool flush = true);
     void clear_sequences (bool flush = true);
     void clear_mutes (bool flush = true);
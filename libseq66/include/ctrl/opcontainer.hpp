@@ -62,8 +62,8 @@
  *  It requires C++11 and above.
  */
 
-#include <map>                          /* std::map<>                       */
 #include <string>                       /* std::string                      */
+#include <vector>                       /* std::vector<>                    */
 
 #include "ctrl/midioperation.hpp"       /* seq66::midioperation             */
 
@@ -85,12 +85,13 @@ class opcontainer
 public:
 
     /**
-     *  Provides the type definition for this container.  The key is the
-     *  operation number (generally ranging from 0 to 31 for each
-     *  automation::category), and the value is a midioperation object.
+     *  Provides the type definition for this container.  It is indexed
+     *  directly by the operation number (automation::slot), so that looking
+     *  up the operation for an incoming MIDI control costs no search.  Slots
+     *  with no operation hold an unusable default midioperation.
      */
 
-    using opmap = std::map<automation::slot, midioperation>;
+    using opvector = std::vector<midioperation>;
 
 private:
 
@@ -98,7 +99,7 @@ private:
      *  The container itself.
      */
 
-    opmap m_container;
+    opvector m_container;
 
     /**
      *  A name to use for showing the contents of the container.
@@ -126,7 +127,7 @@ public:
 
     void clear ()
     {
-        m_container.clear();
+        m_container.assign(m_container.size(), midioperation());
     }
 
     bool add (const midioperation & op);
@@ -42,6 +42,7 @@
 #include <memory>                       /* std::shared_ptr<>                */
 #include <vector>                       /* for containing the bus objects   */
 
+#include "midi/event.hpp"               /* seq66::event pending input       */
 #include "midi/midibus_common.hpp"      /* enum class e_clock               */
 #include "midi/midibus.hpp"             /* seq66::midibus                   */
 
@@ -97,6 +98,20 @@ private:
 
     bool m_init_input;
 
+    /**
+     *  Holds the next event from this input bus, read ahead so that
+     *  busarray::get_midi_event() can compare the arrival times of the next
+     *  events of all of the input busses.
+     */
+
+    event m_pending;
+
+    /**
+     *  Indicates that m_pending holds an event not yet handed out.
+     */
+
+    bool m_has_pending;
+
 public:
 
     businfo () = delete;
@@ -237,6 +252,14 @@ private:
 
     std::vector<businfo> m_container;
 
+    /**
+     *  The input bus to be favored when pending input events have the same
+     *  arrival time (or the bus provides no arrival time).  It advances past
+     *  each bus that is served, so that no bus can starve the others.
+     */
+
+    int m_next_input;
+
 public:
 
     busarray ();
@@ -365,6 +388,7 @@ public:
 
     bool get_input (bussbyte bus) const;
     bool is_system_port (bussbyte bus);
+    long input_age_us (bussbyte bus, midipulse stamp);
     int poll_for_midi ();
     bool get_midi_event (event * inev);
     int replacement_port (int bus, int port);
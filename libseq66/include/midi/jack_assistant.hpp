@@ -40,6 +40,10 @@
 
 #if defined SEQ66_JACK_SUPPORT
 
+#include <atomic>                       /* std::atomic<> for cycle sync     */
+#include <condition_variable>           /* std::condition_variable          */
+#include <mutex>                        /* std::mutex                       */
+
 #include <jack/jack.h>
 #include <jack/transport.h>
 
@@ -363,6 +367,50 @@ private:
 
     midibpm m_beats_per_minute;
 
+    /**
+     *  If true ("jack-cycle-sync" in the 'rc' file), the output thread is
+     *  paced by the JACK process cycle, and uses the transport state and
+     *  position captured by jack_transport_callback() at the start of each
+     *  cycle, rather than querying JACK transport on its own schedule.
+     */
+
+    bool m_cycle_sync;
+
+    /**
+     *  A sequence lock for m_cycle_state and m_cycle_pos.  It is odd while
+     *  the process callback is writing them, and is bumped by 2 each cycle.
+     */
+
+    std::atomic<unsigned> m_cycle_serial;
+
+    /**
+     *  The transport state captured at the start of the latest cycle.
+     */
+
+    jack_transport_state_t m_cycle_state;
+
+    /**
+     *  The transport position captured at the start of the latest cycle.
+     */
+
+    jack_position_t m_cycle_pos;
+
+    /**
+     *  The microtime() at the start of the latest cycle, so that the output
+     *  thread can tell how late it woke for the cycle.
+     */
+
+    std::atomic<long> m_cycle_us;
+
+    /**
+     *  Wakes the output thread once per cycle when m_cycle_sync is true.
+     *  The callback never locks the mutex; a missed wakeup only costs the
+     *  wait timeout.
+     */
+
+    std::mutex m_cycle_mutex;
+    std::condition_variable m_cycle_cond;
+
 public:
 
     jack_assistant
@@ -488,6 +536,13 @@ public:
     void stop (bool rewind = false);
     void position (bool state, midipulse tick = 0);
     bool output (jack_scratchpad & pad);
+    void post_cycle (jack_transport_state_t s, const jack_position_t & pos);
+    bool wait_cycle (long & lateus);
+
+    bool cycle_sync () const
+    {
+        return m_cycle_sync && m_jack_running;
+    }
 
     /**
      * \setter m_ppqn
@@ -626,6 +681,7 @@ private:
     void update_timebase_master (jack_transport_state_t s);
 #endif
     void set_position (midipulse currenttick);
+    bool cycle_snapshot (jack_transport_state_t & s, jack_position_t & pos);
 
 };          // class jack_assistant
 
@@ -36,10 +36,14 @@
  *  PortMidi.
  */
 
+#include <atomic>                       /* std::atomic<> event counter      */
+#include <bitset>                       /* std::bitset for sounding notes   */
 #include <vector>                       /* for channel-filtered recording   */
 
 #include "midi/businfo.hpp"             /* seq66::businfo & busarray        */
+#include "midi/event.hpp"               /* seq66::event for captured events */
 #include "midi/midibase.hpp"            /* seq66::midibase::io & recmutex   */
+#include "midi/midithru.hpp"            /* seq66::midithru routes table     */
 #include "play/clockslist.hpp"          /* list of seq66::e_clock settings  */
 #include "play/inputslist.hpp"          /* list of boolean input settings   */
 
@@ -49,7 +53,6 @@
 
 namespace seq66
 {
-    class event;
     class midibus;
     class sequence;
 
@@ -163,6 +166,67 @@ protected:
 
     sequence * m_seq;
 
+    /**
+     *  Tracks the notes left sounding on each output buss and channel by the
+     *  events sent via play(), so that panic() need turn off only those
+     *  notes, rather than every note on every channel of every buss.
+     */
+
+    std::bitset<c_notes_count> m_sounding_notes
+        [c_busscount_max][c_midichannel_max];
+
+    /**
+     *  Flags the channels of each output buss that have carried channel
+     *  messages since the last panic().  Used for the optional All Sound Off
+     *  and All Notes Off messages sent by panic().
+     */
+
+    std::bitset<c_midichannel_max> m_used_channels[c_busscount_max];
+
+    /**
+     *  The direct thru routes, handed to the MIDI engine by api_init() in
+     *  implementations that can apply them in their driver callback.  Set up
+     *  before init(), and not changed afterward.
+     */
+
+    midithru m_midi_thru;
+
+    /**
+     *  If true, play(), play_and_flush(), and sysex() record the events they
+     *  are given instead of sending them, and tempo changes are recorded as
+     *  well.  Used for rendering a song offline; see performer::render_song().
+     */
+
+    bool m_capturing;
+
+    /**
+     *  The tick stamped on each captured event.  The renderer sets it before
+     *  playing each pulse.
+     */
+
+    midipulse m_capture_tick;
+
+    /**
+     *  The captured events, one list per output buss.
+     */
+
+    std::vector<event> m_captured[c_busscount_max];
+
+    /**
+     *  The captured tempo events, starting with the tempo at the start of
+     *  the capture.
+     */
+
+    std::vector<event> m_captured_tempos;
+
+    /**
+     *  Counts the events sent by play(), play_and_flush(), and sysex().  The
+     *  output thread samples it each frame for the events-per-frame
+     *  statistic; see performer::play_stats().
+     */
+
+    std::atomic<unsigned long> m_events_played;
+
     /**
      *  The locking mutex.  This object is passed to an automutex object that
      *  lends exception-safety to the mutex locking.
@@ -220,6 +284,21 @@ public:
         m_filter_by_channel = flag;
     }
 
+    const midithru & midi_thru () const
+    {
+        return m_midi_thru;
+    }
+
+    void midi_thru (const midithru::routes & r, const notemapper * nm)
+    {
+        m_midi_thru.setup(r, nm);
+    }
+
+    void midi_thru_notes (const notemapper * nm)
+    {
+        m_midi_thru.map_notes(nm);
+    }
+
     midibpm get_beats_per_minute () const
     {
         return m_beats_per_minute;
@@ -296,14 +375,64 @@ public:
         return api_get_midi_event(in);
     }
 
+    /**
+     *  Grabs up to the given number of MIDI events in one call, in order of
+     *  arrival.  No locking.
+     *
+     * \param inevs
+     *      Provides an array of at least maxcount events to be filled.
+     *
+     * \param maxcount
+     *      The maximum number of events to get.
+     *
+     * \return
+     *      Returns the number of events copied into the array.
+     */
+
+    int get_midi_events (event * inevs, int maxcount)
+    {
+        int result = 0;
+        while (result < maxcount && api_get_midi_event(&inevs[result]))
+            ++result;
+
+        return result;
+    }
+
     e_clock get_clock (bussbyte bus) const;
     bool set_clock (bussbyte bus, e_clock clock_type);
     bool get_input (bussbyte bus) const;
     bool set_input (bussbyte bus, bool inputing);
     bool is_input_system_port (bussbyte bus);
+    long input_age_us (const event & ev);
     void copy_io_busses ();
     void set_ppqn (int ppqn);
     void set_beats_per_minute (midibpm bpm);
+    void capture (bool flag);
+
+    bool capturing () const
+    {
+        return m_capturing;
+    }
+
+    unsigned long events_played () const
+    {
+        return m_events_played.load(std::memory_order_relaxed);
+    }
+
+    void capture_tick (midipulse tick)
+    {
+        m_capture_tick = tick;
+    }
+
+    const std::vector<event> & captured (bussbyte bus) const
+    {
+        return m_captured[bus];
+    }
+
+    const std::vector<event> & captured_tempos () const
+    {
+        return m_captured_tempos;
+    }
 
 protected:
 
@@ -438,6 +567,8 @@ private:
 
     bool save_clock (bussbyte bus, e_clock clock);
     bool save_input (bussbyte bus, bool inputing);
+    void track_note (bussbyte bus, const event * e24, midibyte channel);
+    void capture_event (bussbyte bus, const event * e24, midibyte channel);
 
 };          // class mastermidibase
 
@@ -479,6 +479,23 @@ public:
         return m_io_active ? api_poll_for_midi() : 0 ;
     }
 
+    /**
+     *  Provides the time elapsed since an input event arrived, for latency
+     *  compensation of recorded events.
+     *
+     * \param stamp
+     *      The arrival timestamp that the input driver put into the event.
+     *
+     * \return
+     *      Returns the age of the event in microseconds, or 0 if the API does
+     *      not timestamp input events.
+     */
+
+    long input_age_us (midipulse stamp)
+    {
+        return api_input_age_us(stamp);
+    }
+
     void play (const event * e24, midibyte channel);
     void sysex (const event * e24);
     void flush ();
@@ -569,6 +586,15 @@ public:
         return not_nullptr(inev);
     }
 
+    /**
+     *  Used in the JACK implementation.
+     */
+
+    virtual long api_input_age_us (midipulse /*stamp*/)
+    {
+        return 0;
+    }
+
     /**
      *  Not defined in the PortMidi implementation.
      */
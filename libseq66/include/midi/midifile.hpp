@@ -228,6 +228,7 @@ public:
     virtual bool write (performer & p, bool doseqspec = true);
 
     bool write_song (performer & p);
+    bool write_capture (performer & p, midipulse endtick);
 
     const std::string & error_message () const
     {
@@ -395,7 +396,16 @@ protected:
     }
 
     void write_varinum (midilong);
+    bool write_file (const std::string & openerror);
     void write_track (const midi_vector & lst);
+    void write_captured_track
+    (
+        performer & p,
+        const std::vector<event> & evlist,
+        const std::string & name,
+        int track,
+        midipulse endtick
+    );
     void write_track_name (const std::string & trackname);
     void write_track_end ();
     std::string read_track_name();
@@ -471,6 +481,12 @@ extern bool write_midi_file
     const std::string & fn,
     std::string & errmsg
 );
+extern bool render_midi_file
+(
+    performer & p,
+    const std::string & fn,
+    std::string & errmsg
+);
 
 }           // namespace seq66
 
@@ -0,0 +1,160 @@
+#if ! defined SEQ66_MIDITHRU_HPP
+#define SEQ66_MIDITHRU_HPP
+
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          midithru.hpp
+ *
+ *  This module declares the table of direct MIDI thru routes.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  A thru route copies the channel messages arriving on an input buss
+ *  (optionally only those of one channel) to an output buss, optionally
+ *  changing the channel and mapping the note numbers through the note-mapper.
+ *  The MIDI engine applies the routes in its own driver callback, if it can,
+ *  so that the routed messages do not wait for the input thread, the
+ *  sequence echo, and the output thread.
+ */
+
+#include <atomic>                       /* std::atomic<> note map entries   */
+#include <vector>                       /* std::vector<>                    */
+
+#include "midi/midibytes.hpp"           /* seq66::bussbyte, midibyte        */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+    class notemapper;
+
+/**
+ *  Holds the thru routes.  The routes are set up before the MIDI engine is
+ *  activated, and are then only read, so that the driver callback can use
+ *  them without locking.  The note map can be refreshed at any time, as the
+ *  note-mapper may be read or replaced after the routes are set up.
+ */
+
+class midithru
+{
+
+public:
+
+    /**
+     *  A single route.  A channel of -1 means any channel for the input, and
+     *  the same channel for the output.
+     */
+
+    struct route
+    {
+        bussbyte mtr_in_buss;           /**< The input buss to be routed.   */
+        int mtr_in_channel;             /**< The input channel, or -1.      */
+        bussbyte mtr_out_buss;          /**< The output buss.               */
+        int mtr_out_channel;            /**< The output channel, or -1.     */
+        bool mtr_map_notes;             /**< Use the note-mapper.           */
+    };
+
+    using routes = std::vector<route>;
+    using indices = std::vector<int>;
+
+private:
+
+    /**
+     *  The routes to apply, in order.  A message matching several routes is
+     *  sent to each of their outputs.
+     */
+
+    routes m_routes;
+
+    /**
+     *  The note-mapper conversions, copied into an array so that the driver
+     *  callback need not search the note-mapper's map.
+     */
+
+    std::atomic<midibyte> m_note_map[c_midibyte_data_max];
+
+    /**
+     *  For each input buss and channel, the indices of the routes that can
+     *  apply to its messages, so that the driver callback need not check
+     *  every route for every message.
+     */
+
+    indices m_lookup[c_busscount_max][c_midichannel_max];
+
+public:
+
+    midithru ();
+    midithru (const midithru &) = delete;
+    midithru & operator = (const midithru &) = delete;
+    ~midithru () = default;
+
+    void setup (const routes & r, const notemapper * nm = nullptr);
+    void map_notes (const notemapper * nm);
+
+    /**
+     *  Provides the indices of the routes that can apply to a channel
+     *  message arriving on a buss.
+     */
+
+    const indices & lookup (bussbyte inbus, midibyte status) const
+    {
+        static const indices s_none;
+        return inbus < c_busscount_max ?
+            m_lookup[inbus][status & 0x0F] : s_none ;
+    }
+
+    bool active () const
+    {
+        return ! m_routes.empty();
+    }
+
+    int count () const
+    {
+        return int(m_routes.size());
+    }
+
+    const route & at (int index) const
+    {
+        return m_routes[index];
+    }
+
+    bool apply
+    (
+        const route & r, bussbyte inbus, midibyte * msg, int len
+    ) const;
+
+};              // class midithru
+
+}               // namespace seq66
+
+#endif          // SEQ66_MIDITHRU_HPP
+
+/*
+ * midithru.hpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -111,6 +111,15 @@ private:
 
     midibooleans m_mutegroup_vector;
 
+    /**
+     *  Holds the same statuses as m_mutegroup_vector, as a fixed-width
+     *  bitset, so that applying, toggling, and testing the group are
+     *  word-wide operations.  The vector remains the form used in reading and
+     *  writing the group.
+     */
+
+    screenset::armbits m_mutegroup_bits;
+
     /**
      *  Indicates the number of virtual rows in a screen-set (bank), which is
      *  also the same number of virtual rows as a mute-group.  This value will
@@ -234,6 +243,11 @@ public:
 
     bool set (const midibooleans & bits);
 
+    const screenset::armbits & bits () const
+    {
+        return m_mutegroup_bits;
+    }
+
     const midibooleans & zeroes () const
     {
         static midibooleans s_bits(m_group_size, midibool(false));
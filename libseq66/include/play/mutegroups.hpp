@@ -421,10 +421,13 @@ public:
         return m_rows * m_columns;
     }
 
-    bool apply (mutegroup::number group, midibooleans & bits);
-    bool unapply (mutegroup::number group, midibooleans & bits);
-    bool toggle (mutegroup::number group, midibooleans & bits);
-    bool toggle_active (mutegroup::number group, midibooleans & armedbits);
+    bool apply (mutegroup::number group, screenset::armbits & bits);
+    bool unapply (mutegroup::number group, screenset::armbits & bits);
+    bool toggle (mutegroup::number group, screenset::armbits & bits);
+    bool toggle_active
+    (
+        mutegroup::number group, screenset::armbits & armedbits
+    );
 
     bool loaded_from_mutes () const
     {
@@ -48,6 +48,7 @@
 #include <set>                          /* std::set, arbitary selection     */
 #endif
 
+#include <atomic>                       /* std::atomic<> for cached extent  */
 #include <memory>                       /* std::shared_ptr<>, unique_ptr<>  */
 #include <vector>                       /* std::vector<>                    */
 #include <thread>                       /* std::thread                      */
@@ -58,6 +59,7 @@
 #include "midi/mastermidibus.hpp"       /* seq66::mastermidibus ALSA/JACK   */
 #include "play/metro.hpp"               /* seq66::metro metronome pattern   */
 #include "play/playlist.hpp"            /* seq66::playlist                  */
+#include "play/playstats.hpp"           /* seq66::playstats histograms      */
 #include "play/sequence.hpp"            /* seq66::sequence                  */
 #include "play/setmapper.hpp"           /* seq66::seqmanager and seqstatus  */
 #include "util/condition.hpp"           /* seq66::condition/synchronizer    */
@@ -701,6 +703,36 @@ private:                            /* key, midi, and op container section  */
 
     std::atomic<bool> m_resolution_change;
 
+    /**
+     *  Held by a thread while a bulk operation runs a sequence handler on
+     *  it.  The per-sequence change notifications and pattern announcements
+     *  made by that thread are then dropped, and the operation sends one
+     *  notification when all of the threads are done.  The count is kept
+     *  per thread, so other threads, such as the I/O threads, still notify.
+     */
+
+    class notify_deferral
+    {
+
+    public:
+
+        notify_deferral ();
+        notify_deferral (const notify_deferral &) = delete;
+        notify_deferral & operator = (const notify_deferral &) = delete;
+        ~notify_deferral ();
+
+        static bool active ();
+
+    };
+
+    /**
+     *  Set while render_song() drives the playback engine against a
+     *  simulated clock.  The sequences then skip the short sleeps meant to
+     *  keep real-time playback from hogging a CPU.
+     */
+
+    bool m_rendering;
+
     /**
      *  Indicates the number of beats considered in calculating the BPM via
      *  button tapping.  This value is displayed in the button.
@@ -716,6 +748,20 @@ private:                            /* key, midi, and op container section  */
 
     long m_delta_us;
 
+    /**
+     *  The buffer into which poll_cycle() fetches a batch of input events.
+     *  Allocated once, and used only by the input thread.
+     */
+
+    std::vector<event> m_input_batch;
+
+    /**
+     *  Holds the timing histograms of the output thread and the play() cost
+     *  of each pattern.  Always kept; see play_stats() and playstats.hpp.
+     */
+
+    playstats m_play_stats;
+
     /**
      *  Indicates the first time the tap button was ... tapped.
      */
@@ -838,6 +884,18 @@ private:                            /* key, midi, and op container section  */
 
     midipulse m_max_extent;
 
+    /**
+     *  Caches the result of get_max_extent(), which otherwise walks every
+     *  set and sequence.  The cache is marked stale by invalidate_extent(),
+     *  which is called from the notification functions, from modify(), and
+     *  from sequence::set_dirty() (which covers recording and other edits
+     *  that do not notify).  Both are atomic because the extent is read by
+     *  the output thread (auto-stop) as well as by the GUI timers.
+     */
+
+    mutable std::atomic<midipulse> m_extent_cache;
+    mutable std::atomic<bool> m_extent_stale;
+
     /**
      *  Holds a bunch of jack_assistant settings.
      */
@@ -1082,6 +1140,7 @@ public:
     void modify ()
     {
         m_is_modified = true;
+        invalidate_extent();
 
         /*
          * Relating to the fix for issue #90, do not use this (silly) flag.
@@ -1163,6 +1222,7 @@ public:
     }
 
     bool open_note_mapper (const std::string & notefile);
+    void note_mapper (std::unique_ptr<notemapper> nm);
     bool save_note_mapper (const std::string & notefile = "");
     bool open_mutegroups (const std::string & mfg);
     bool save_mutegroups (const std::string & mfg = "");
@@ -1640,6 +1700,11 @@ public:
         return m_is_running;
     }
 
+    bool rendering () const
+    {
+        return m_rendering;
+    }
+
     /*
      *  Used in conjunction with user-interface control of playback (start,
      *  stop, pause).
@@ -1676,11 +1741,21 @@ public:
     {
         return m_jack_asst.output(pad);
     }
+
+    bool jack_wait_cycle (long & lateus)
+    {
+        return m_jack_asst.wait_cycle(lateus);
+    }
 #else
     bool jack_output (jack_scratchpad & /*pad*/)
     {
         return false;
     }
+
+    bool jack_wait_cycle (long & /*lateus*/)
+    {
+        return false;
+    }
 #endif
 
     /**
@@ -2104,6 +2179,7 @@ public:
     void auto_play ();
     void play_all_sets (midipulse tick);
     void play (midipulse tick);
+    bool render_song (midipulse & endtick);
     void all_notes_off ();
 
     void unqueue_sequences (int hotseq)
@@ -2251,6 +2327,16 @@ public:
         return m_delta_us;
     }
 
+    playstats & play_stats ()
+    {
+        return m_play_stats;
+    }
+
+    const playstats & play_stats () const
+    {
+        return m_play_stats;
+    }
+
     void clear_current_beats ()
     {
         m_current_beats = m_base_time_ms = m_last_time_ms = 0;
@@ -2476,6 +2562,7 @@ public:
     bool unapply_mutes (mutegroup::number group);
     bool toggle_mutes (mutegroup::number group);
     bool toggle_active_mutes (mutegroup::number group);
+    void settle_mutes ();
 
     bool toggle_active_only () const
     {
@@ -2759,6 +2846,18 @@ public:
     }
 
     midipulse get_max_extent () const;
+
+    /**
+     *  Marks the cached song extent as stale, so that the next call to
+     *  get_max_extent() recalculates it.  Cheap enough to call from any
+     *  edit path.
+     */
+
+    void invalidate_extent () const
+    {
+        m_extent_stale = true;
+    }
+
     std::string duration (bool dur = true) const;
     int count_exportable () const;
     bool convert_to_smf_0 (bool remove_old = true);
@@ -3410,6 +3509,8 @@ private:
     void output_func ();
     void input_func ();
     bool poll_cycle ();
+    bool dispatch_input_event (event & ev);
+    midipulse input_tick (const event & ev);
     void launch_input_thread ();
     void launch_output_thread ();
     void midi_start ();
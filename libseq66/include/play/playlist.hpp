@@ -169,6 +169,14 @@ private:
 
         int ls_song_count;
 
+        /**
+         *  Indicates that the song files of this playlist have been checked.
+         *  Only the current list is checked when the playlist file is
+         *  opened; the others are checked when first selected.
+         */
+
+        bool ls_verified;
+
         /**
          *  A container holding the list of information for the songs in the
          *  playlist.
@@ -466,7 +474,8 @@ private:
         const std::string & fmt,
         const std::string & filename
     );
-    bool verify (bool strong = false);
+    bool verify (bool strong = false, bool lazy = false);
+    bool verify_list (play_list_t & plist, bool strong);
 
     play_list & play_list_map ()
     {
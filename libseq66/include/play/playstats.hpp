@@ -0,0 +1,206 @@
+#if ! defined SEQ66_PLAYSTATS_HPP
+#define SEQ66_PLAYSTATS_HPP
+
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          playstats.hpp
+ *
+ *  This module declares the timing statistics of the output thread.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  The output thread (performer::output_func()) adds a sample to each
+ *  histogram every frame:
+ *
+ *      -   lateness: How late, in microseconds, the thread woke from its
+ *          sleep, or started the frame after an underrun.  When the thread
+ *          is paced by the JACK cycle, how long after the start of the
+ *          cycle it woke.
+ *      -   frame: The time, in microseconds, taken to process the frame.
+ *      -   events: The number of events sent to the master buss.
+ *      -   lockwait: The time, in nanoseconds, sequence::play() waited for
+ *          the pattern's lock.  One sample per pattern per frame.
+ *
+ *  The time each pattern spends in sequence::play_queue() is added up per
+ *  pattern as well.  The output thread does most of the adding, but any
+ *  thread that calls performer::play(), such as the playbench benchmark,
+ *  adds too, and any thread can read.  All counters are relaxed atomics,
+ *  and the maximums are raised with a compare-exchange loop, so there is no
+ *  locking and no sample is lost.  A reader can see a sample half-added,
+ *  which does not matter for statistics.
+ */
+
+#include <atomic>                       /* std::atomic<>                    */
+#include <string>                       /* std::string                      */
+#include <vector>                       /* std::vector<>                    */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  A histogram with power-of-2 buckets.  Bucket 0 counts values of 0 or
+ *  less; bucket b counts values from 2^(b-1) to 2^b - 1; the last bucket
+ *  also counts everything larger.
+ */
+
+class histogram
+{
+
+public:
+
+    static const int c_bucket_count = 24;
+
+private:
+
+    std::atomic<unsigned long> m_buckets[c_bucket_count];
+    std::atomic<unsigned long> m_samples;
+    std::atomic<long long> m_sum;
+    std::atomic<long> m_max;
+
+public:
+
+    histogram ();
+
+    void add (long value);
+    void clear ();
+
+    unsigned long bucket (int b) const
+    {
+        return b >= 0 && b < c_bucket_count ?
+            m_buckets[b].load(std::memory_order_relaxed) : 0 ;
+    }
+
+    unsigned long samples () const
+    {
+        return m_samples.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  The largest sample, or 0 if there are none.  The stored maximum
+     *  starts at the smallest long value, so that the first sample, which
+     *  can be negative, always raises it.
+     */
+
+    long maximum () const
+    {
+        return samples() > 0 ? m_max.load(std::memory_order_relaxed) : 0 ;
+    }
+
+    double mean () const;
+    long percentile (double p) const;
+    std::string summary (const std::string & units) const;
+    static long bucket_limit (int b);
+
+};          // class histogram
+
+/**
+ *  Holds the histograms of the output thread, and the play() cost of each
+ *  pattern.
+ */
+
+class playstats
+{
+
+public:
+
+    /**
+     *  Selects one of the histograms.  See the file banner.
+     */
+
+    enum class measure
+    {
+        lateness,
+        frame,
+        events,
+        lockwait,
+        max
+    };
+
+private:
+
+    /**
+     *  The play() cost of one pattern.
+     */
+
+    struct seqcost
+    {
+        std::atomic<unsigned long> sc_calls;    /**< Frames played.         */
+        std::atomic<long long> sc_total_ns;     /**< Time in play_queue().  */
+        std::atomic<long> sc_max_ns;            /**< The longest call.      */
+    };
+
+    histogram m_histograms[static_cast<int>(measure::max)];
+
+    /**
+     *  One entry per pattern number, allocated once, so that no allocation
+     *  is done by the output thread.
+     */
+
+    std::vector<seqcost> m_seq_costs;
+
+public:
+
+    playstats (int seqcount);
+
+    /**
+     *  A monotonic time in nanoseconds, for the short intervals.
+     */
+
+    static long now_ns ();
+
+    void add (measure m, long value)
+    {
+        m_histograms[static_cast<int>(m)].add(value);
+    }
+
+    const histogram & get (measure m) const
+    {
+        return m_histograms[static_cast<int>(m)];
+    }
+
+    unsigned long frames () const
+    {
+        return get(measure::frame).samples();
+    }
+
+    void add_sequence_cost (int seqno, long ns);
+    void clear ();
+    std::string report (int topcount = 8) const;
+
+};          // class playstats
+
+}           // namespace seq66
+
+#endif      // SEQ66_PLAYSTATS_HPP
+
+/*
+ * playstats.hpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
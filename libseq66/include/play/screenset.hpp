@@ -38,6 +38,7 @@
  *  current states of the tracks or sets.
  */
 
+#include <bitset>                       /* std::bitset<> for armbits        */
 #include <functional>                   /* std::function, function objects  */
 #include <vector>                       /* std::vector<>                    */
 
@@ -151,6 +152,21 @@ public:
 
     static const int c_max_columns = 12;
 
+    /**
+     *  The largest number of slots in a set.
+     */
+
+    static const int c_max_set_size = c_max_rows * c_max_columns;
+
+    /**
+     *  Holds one armed (unmuted) flag per slot of a set, for any set size.
+     *  Mute-groups are applied, toggled, and learned as whole words of these
+     *  bits, rather than one boolean at a time.  Bit 0 is the first slot of
+     *  the set.
+     */
+
+    using armbits = std::bitset<c_max_set_size>;
+
 private:
 
     /**
@@ -527,7 +543,9 @@ private:
     void pop_trigger_redo ();
 
     bool apply_bits (const midibooleans & mg);
+    bool apply_bits (const armbits & bits);
     bool learn_bits (midibooleans & mg);
+    bool learn_bits (armbits & bits);
 
     /*
      * For a non-existent sequence number, should this return a dummy (inactive)
@@ -41,6 +41,7 @@
 #include <atomic>                       /* std::atomic<bool> for dirt       */
 #include <stack>                        /* std::stack<eventlist>            */
 #include <string>                       /* std::string                      */
+#include <vector>                       /* std::vector<note_info>           */
 
 #include "seq66_features.hpp"           /* various feature #defines         */
 #include "cfg/usrsettings.hpp"          /* enum class record                */
@@ -227,6 +228,7 @@ public:
         int ni_note;                /* for tempo, the location to paint it  */
         int ni_velocity;            /* for tempo, the truncated tempo value */
         bool ni_selected;
+        draw ni_draw;               /* set only by notes_in_range()         */
 
     public:
 
@@ -235,7 +237,8 @@ public:
             ni_tick_finish  (0),
             ni_note         (0),
             ni_velocity     (0),
-            ni_selected     (false)
+            ni_selected     (false),
+            ni_draw         (draw::none)
             {
                 // no code
             }
@@ -270,10 +273,21 @@ public:
            return ni_selected;
        }
 
+       draw draw_type () const
+       {
+           return ni_draw;
+       }
+
        void show () const;
 
     };      // nested class note_info
 
+    /**
+     *  A list of notes returned by notes_in_range().
+     */
+
+    using notelist = std::vector<note_info>;
+
 private:
 
     /**
@@ -452,6 +466,15 @@ private:
 
     unsigned short m_playing_notes[c_notes_count];
 
+    /**
+     *  The event handed to the master buss by put_event_on_bus().  It is
+     *  reused, with only its status, data, and timestamp rewritten, so that
+     *  playback constructs no events.  Protected by m_mutex, which all
+     *  callers of put_event_on_bus() hold.
+     */
+
+    event m_emit_event;
+
     /**
      *  Indicates if the sequence was playing.  This value is set at the end
      *  of the play() function.  It is used to continue playing after changing
@@ -669,6 +692,31 @@ private:
 
     mutable std::atomic<bool> m_dirty_names;
 
+    /**
+     *  A counter bumped by set_dirty(), by the selection functions, and by
+     *  the trigger functions that do not call modify().  Unlike the dirty
+     *  flags, it is not reset by being read, so any number of views can
+     *  compare it against the value they last rendered, and rebuild their
+     *  cached drawings only when it changes.
+     */
+
+    std::atomic<unsigned> m_edit_generation;
+
+    /**
+     *  A drawing index of the notes (and tempo events) of the pattern, used
+     *  by notes_in_range().  Each bucket covers 2^m_note_shift ticks, and
+     *  holds the indices (into m_note_index) of every note that overlaps
+     *  those ticks.  The index is rebuilt lazily, when the edit generation
+     *  or the event count no longer match the values recorded when it was
+     *  built.  Protected by m_mutex.
+     */
+
+    mutable notelist m_note_index;
+    mutable std::vector<std::vector<int>> m_note_buckets;
+    mutable int m_note_shift;
+    mutable unsigned m_note_index_generation;
+    mutable int m_note_index_count;
+
     /**
      *  Indicates the pattern was modified.  Unlike the is_dirty_xxx flags,
      *  this one is not reset when checked.  Useful when closing a file or the
@@ -710,6 +758,7 @@ private:
     midipulse m_last_tick;          /**< Provides the last tick played.     */
     midipulse m_queued_tick;        /**< Provides the tick for queuing.     */
     midipulse m_trigger_offset;     /**< Provides the trigger offset.       */
+    unsigned m_play_count;          /**< Counts play() calls, for sampling. */
 
     /**
      *  This constant provides the scaling used to calculate the time position
@@ -1493,6 +1542,12 @@ public:
     bool is_dirty_names () const;
     void set_dirty_mp ();
     void set_dirty ();
+
+    unsigned edit_generation () const
+    {
+        return m_edit_generation;
+    }
+
     std::string channel_string () const;            /* "F" or "<channel+1>" */
 
     midibyte seq_midi_channel () const
@@ -1626,6 +1681,7 @@ public:
     midipulse selected_trigger_end ();
     midipulse get_max_timestamp () const;
     midipulse get_max_trigger () const;
+    midipulse get_max_extent () const;
     void copy_triggers (midipulse start_tick, midipulse distance);
 
     midipulse get_trigger_offset () const
@@ -1809,6 +1865,12 @@ public:
         note_info & niout,
         event::buffer::const_iterator & evi
     ) const;
+    int notes_in_range
+    (
+        midipulse tick_s, midipulse tick_f,
+        int note_l, int note_h, notelist & notesout
+    ) const;
+    event::buffer::const_iterator cbegin (midipulse tick) const;
     bool get_next_event_match
     (
         midibyte status, midibyte cc,
@@ -1951,11 +2013,12 @@ private:
         midibyte status, midibyte cc, int divide, bool linked = false
     );
     bool change_ppqn (int p);
-    void put_event_on_bus (const event & ev);
+    void put_event_on_bus (const event & ev, int transpose = 0);
     void reset_loop ();
     void set_trigger_offset (midipulse trigger_offset);
     void adjust_trigger_offsets_to_length (midipulse newlen);
     midipulse adjust_offset (midipulse offset);
+    void rebuild_note_index () const;       /* used only internally     */
     draw get_note_info                      /* used only internally     */
     (
         note_info & niout,
@@ -42,6 +42,9 @@
  *  allowed in a given run of the application.
  */
 
+#include <atomic>                       /* std::atomic<bool>                */
+#include <mutex>                        /* std::mutex, std::lock_guard      */
+
 #include "play/mutegroups.hpp"          /* seq66::mutegroups & mutegroup    */
 #include "play/setmaster.hpp"           /* seq66::seqmanager and seqstatus  */
 
@@ -160,6 +163,29 @@ private:
 
     midibooleans m_tracks_mute_state;
 
+    /**
+     *  Holds the armed statuses of the play-screen resulting from the last
+     *  mute-group operation, until the output thread applies them at the start
+     *  of its next frame.  Thus a mute-group change lands entirely within one
+     *  frame, instead of being spread over the sequences as the output thread
+     *  plays them.  See publish_bits() and apply_pending_bits().
+     */
+
+    screenset::armbits m_pending_bits;
+
+    /**
+     *  Indicates that m_pending_bits holds statuses not yet applied.  Checked
+     *  without locking in each output frame.
+     */
+
+    std::atomic<bool> m_bits_pending;
+
+    /**
+     *  Guards m_pending_bits.
+     */
+
+    std::mutex m_pending_mutex;
+
 public:
 
     setmapper () = delete;
@@ -551,8 +577,9 @@ private:
      * exec_set_function(s) executes a set-handler for each set.
      * exec_set_function(s,p) runs a set-handler and a slot-handler for each
      * set.  exec_set_function(p) runs the slot-handler for all patterns in
-     * all sets.  exec_slot_function(p) runs the slot-handler for the
-     * play-screen patterns.
+     * all sets.  exec_parallel_function(p) does that on several threads.
+     * exec_slot_function(p) runs the slot-handler for the play-screen
+     * patterns.
      */
 
     bool exec_set_function (screenset::sethandler s)
@@ -570,6 +597,11 @@ private:
         return master().exec_set_function(p);
     }
 
+    bool exec_parallel_function (screenset::slothandler p)
+    {
+        return master().exec_parallel_function(p);
+    }
+
     bool exec_slot_function
     (
         screenset::slothandler p,
@@ -898,6 +930,7 @@ public:
     bool unapply_mutes (mutegroup::number gmute);
     bool toggle_mutes (mutegroup::number gmute);
     bool toggle_active_mutes (mutegroup::number gmute);
+    bool apply_pending_bits ();
     bool learn_mutes (bool learnmode, mutegroup::number gmute);
     bool clear_mutes ();
     void select_and_mute_group (mutegroup::number group);
@@ -918,6 +951,8 @@ private:
     bool add_to_play_set (playset & p, screenset & s);
     bool add_all_sets_to_play_set (playset & p);
     void recount_sequences ();
+    void publish_bits (const screenset::armbits & bits);
+    bool learn_pending_bits (screenset::armbits & bits);
 
     setmaster::container::iterator add_set (screenset::number setno)
     {
@@ -256,13 +256,15 @@ private:
      * exec_set_function(s) executes a set-handler for each set.
      * exec_set_function(s,p) runs a set-handler and a slot-handler for each
      * set.  exec_set_function(p) runs the slot-handler for all patterns in
-     * all sets.  exec_slot_function() uses the play-screen, and so is in
-     * setmapper, not here.
+     * all sets.  exec_parallel_function(p) does the same for the existing
+     * patterns, spread over several threads.  exec_slot_function() uses the
+     * play-screen, and so is in setmapper, not here.
      */
 
     bool exec_set_function (screenset::sethandler s);
     bool exec_set_function (screenset::sethandler s, screenset::slothandler p);
     bool exec_set_function (screenset::slothandler p);
+    bool exec_parallel_function (screenset::slothandler p);
 
 private:
 
@@ -142,6 +142,7 @@ public:
         const std::string & msg
     ) const override;
     virtual bool run () override;
+    virtual void log_to_session (msglevel lev, const std::string & text);
     virtual void session_manager_name (const std::string & mgrname) override;
     virtual void session_manager_path (const std::string & pathname) override;
     virtual void session_display_name (const std::string & dispname) override;
@@ -156,6 +157,7 @@ private:
         const std::string & midifilepath
     );
     bool detect_session (std::string & url);
+    void route_log ();
 
 };          // class clinsmanager
 
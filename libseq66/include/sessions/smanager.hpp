@@ -37,7 +37,9 @@
  *  devices in the system changes.
  */
 
+#include <future>                       /* std::future<>, std::async()      */
 #include <memory>                       /* std::shared_ptr<>, unique_ptr<>  */
+#include <vector>                       /* std::vector<>                    */
 
 #include "play/performer.hpp"           /* seq66::performer                 */
 
@@ -124,6 +126,29 @@ private:
 
     mutable bool m_extant_msg_active;
 
+    /**
+     *  The note-mapper is read in its own thread while the performer is
+     *  launched, and is then handed to the performer.  These members are
+     *  not touched by the main thread until the future is ready.
+     */
+
+    std::future<bool> m_note_map_reader;
+    std::unique_ptr<notemapper> m_note_mapper;
+    std::string m_note_map_errmsg;
+
+    /**
+     *  Holds the name and duration (microseconds) of each startup phase,
+     *  for the report shown by create() in verbose or investigate mode.
+     */
+
+    std::vector<std::pair<std::string, long>> m_startup_phases;
+
+    /**
+     *  The microtime() at which the current startup phase began.
+     */
+
+    long m_phase_start;
+
 public:
 
     smanager (const std::string & caps = "");
@@ -135,8 +160,9 @@ public:
     bool main_settings (int argc, char * argv []);
     bool open_midi_control_file ();
     bool open_playlist ();
-    bool open_note_mapper ();
     bool create_performer ();
+    void start_note_mapper ();
+    bool install_note_mapper ();
     std::string open_midi_file (const std::string & fname);
 
     bool error_active () const
@@ -292,6 +318,8 @@ protected:
     }
 
     void append_error_message (const std::string & message = "") const;
+    void startup_phase (const std::string & name);
+    void show_startup_phases () const;
     bool create_configuration
     (
         int argc, char * argv [],
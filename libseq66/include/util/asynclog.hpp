@@ -0,0 +1,98 @@
+#if ! defined SEQ66_ASYNCLOG_HPP
+#define SEQ66_ASYNCLOG_HPP
+
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          asynclog.hpp
+ *
+ *  This module declares the back-end that writes the console messages.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  The message functions of basic_macros (info_message(), error_message(),
+ *  msgprintf(), etc.) hand their text to this module.  Once
+ *  async_log_start() is called, a message from any thread but the one that
+ *  started the log is copied or formatted straight into a record of a
+ *  lock-free ring, and a background thread writes it out.  So the output
+ *  and input threads never wait on the console streams, and do not
+ *  allocate.  Messages from the starting (main) thread are still written at
+ *  once, so that their order relative to other console output does not
+ *  change.
+ *
+ *  Each message level can be turned off at run-time, before any record is
+ *  queued, and a sink function can be installed to pass the messages on to
+ *  a GUI or session manager.
+ */
+
+#include <cstdarg>                      /* std::va_list                     */
+#include <functional>                   /* std::function<>                  */
+#include <string>                       /* std::string                      */
+
+#include "seq66_features.hpp"           /* seq66::msglevel enumeration      */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  A function to receive each message written, after the console.  It is
+ *  called in the writing thread, so it must not block for long.
+ */
+
+using logsink = std::function<void (msglevel, const std::string &)>;
+
+/*
+ * Global functions.
+ */
+
+extern bool async_log_start ();
+extern void async_log_stop ();
+extern bool async_log_active ();
+extern bool async_log (msglevel lev, const char * const parts [], int count);
+extern bool async_vlog (msglevel lev, const char * fmt, std::va_list args);
+extern void log_write (msglevel lev, const std::string & text);
+extern void log_parts (msglevel lev, const char * const parts [], int count);
+extern void log_message
+(
+    msglevel lev,
+    const std::string & msg,
+    const std::string & data = ""
+);
+extern void log_level (msglevel lev, bool enable);
+extern bool log_level (msglevel lev);
+extern void log_sink (logsink s);
+
+}               // namespace seq66
+
+#endif          // SEQ66_ASYNCLOG_HPP
+
+/*
+ * asynclog.hpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
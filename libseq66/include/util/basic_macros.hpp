@@ -79,8 +79,10 @@ using tokenization = std::vector<std::string>;
 
 extern void set_verbose (bool flag);
 extern void set_investigate (bool flag);
+extern void set_quiet (bool flag);
 extern bool verbose ();
 extern bool investigate ();
+extern bool quiet ();
 
 #if defined SEQ66_PLATFORM_DEBUG
 #if defined __cplusplus
@@ -57,8 +57,26 @@
  *  locking via try_lock(). It Attempts to acquire the lock for the current
  *  execution agent (thread, process, task) without blocking. If an exception
  *  is thrown, no lock is obtained.
+ *
+ *  Lock profiling:
+ *
+ *  When built with SEQ66_LOCK_PROFILE defined (./configure
+ *  --enable-lock-profile), each recmutex records how often it is acquired,
+ *  how often it had to wait for another thread, the total and longest wait,
+ *  and which thread held it during that longest wait.  Give the mutex a name
+ *  when constructing it, so that the report can identify it.  The report of
+ *  the worst offenders is written to the console at exit, and can be had at
+ *  any time from recmutex::profile_report().  When a mutex is destroyed, its
+ *  figures are added to a single entry for its name, so the report still
+ *  covers it, and its entry is reused.  Otherwise the name is ignored and
+ *  the report is empty, and lock() costs no more than before.  Waits inside
+ *  a condition variable (see condition.cpp) are not seen, so the mutex of
+ *  the condition class is left unnamed, and its figures are not to be
+ *  trusted.
  */
 
+#include <string>                       /* std::string for the report       */
+
 /*
  *  We need to expose the native mutex type so that automutex can access it.
  *  We could go back to putting the mutex, automutex, and condition definitions
@@ -74,6 +92,7 @@
 
 namespace seq66
 {
+    struct lockstats;
 
 /**
  *  The mutex class provides a simple wrapper for the pthread_mutex_t type
@@ -112,13 +131,22 @@ private:
 
     mutable native m_mutex_lock;
 
+    /**
+     *  The lock statistics of this mutex, owned by the profile registry in
+     *  recmutex.cpp, or null if lock profiling is not built in.  Handed
+     *  back to the registry by the destructor, and moved, not copied, by
+     *  the move operations.
+     */
+
+    lockstats * m_stats;
+
 public:
 
-    recmutex ();
-    ~recmutex () = default;
-    recmutex (recmutex &&) = default;
+    explicit recmutex (const char * name = nullptr);
+    ~recmutex ();
+    recmutex (recmutex && rhs);
     recmutex (const recmutex &) = delete;
-    recmutex & operator = (recmutex &&) = default;
+    recmutex & operator = (recmutex && rhs);
     recmutex & operator = (const recmutex &) = delete;
 
     void lock () const;
@@ -133,6 +161,10 @@ public:
         return m_mutex_lock;
     }
 
+    static bool profiling ();
+    static std::string profile_report (int topcount = 10);
+    static void profile_clear ();
+
 private:
 
     static void init_global_mutex ();
@@ -43,6 +43,12 @@ contains (CONFIG, rtmidi) {
    DEFINES += "SEQ66_PORTMIDI_SUPPORT=1"
 }
 
+# Mutex contention profiling, "qmake CONFIG+=lock_profile".  See recmutex.hpp.
+
+contains (CONFIG, lock_profile) {
+   DEFINES += "SEQ66_LOCK_PROFILE=1"
+}
+
 HEADERS += include/seq66_features.h \
  include/seq66_features.hpp \
  include/seq66_platform_macros.h \
@@ -93,6 +99,7 @@ HEADERS += include/seq66_features.h \
  include/midi/midi_splitter.hpp \
  include/midi/midi_vector_base.hpp \
  include/midi/midi_vector.hpp \
+ include/midi/midithru.hpp \
  include/midi/wrkfile.hpp \
  include/play/clockslist.hpp \
  include/play/inputslist.hpp \
@@ -102,6 +109,7 @@ HEADERS += include/seq66_features.h \
  include/play/notemapper.hpp \
  include/play/performer.hpp \
  include/play/playlist.hpp \
+ include/play/playstats.hpp \
  include/play/portslist.hpp \
  include/play/screenset.hpp \
  include/play/seq.hpp \
@@ -115,6 +123,7 @@ HEADERS += include/seq66_features.h \
  include/os/daemonize.hpp \
  include/os/shellexecute.hpp \
  include/os/timing.hpp \
+ include/util/asynclog.hpp \
  include/util/automutex.hpp \
  include/util/basic_macros.h \
  include/util/basic_macros.hpp \
@@ -175,6 +184,7 @@ SOURCES += src/seq66_features.cpp \
  src/midi/midi_splitter.cpp \
  src/midi/midi_vector_base.cpp \
  src/midi/midi_vector.cpp \
+ src/midi/midithru.cpp \
  src/midi/wrkfile.cpp \
  src/play/clockslist.cpp \
  src/play/inputslist.cpp \
@@ -184,6 +194,7 @@ SOURCES += src/seq66_features.cpp \
  src/play/notemapper.cpp \
  src/play/performer.cpp \
  src/play/playlist.cpp \
+ src/play/playstats.cpp \
  src/play/portslist.cpp \
  src/play/screenset.cpp \
  src/play/seq.cpp \
@@ -197,6 +208,7 @@ SOURCES += src/seq66_features.cpp \
  src/os/daemonize.cpp \
  src/os/shellexecute.cpp \
  src/os/timing.cpp \
+ src/util/asynclog.cpp \
  src/util/automutex.cpp \
  src/util/basic_macros.cpp \
  src/util/condition.cpp \
@@ -95,6 +95,7 @@ cmdlineopts::s_long_options [] =
     {"help",                0, 0, 'h'},
     {"version",             0, 0, 'V'},
     {"verbose",             0, 0, 'v'},
+    {"quiet",               0, 0, 'Q'},
     {"inspect",             required_argument, 0, 'I'},
     {"investigate",         0, 0, 'i'},
     {"home",                required_argument, 0, 'H'},
@@ -174,7 +175,7 @@ cmdlineopts::s_long_options [] =
  *
 \verbatim
         0123456789#@AaBbCcDdEeFfGgHhIiJjKkLlMmNnOoPpQqRrSsTtUuVvWwXxYyZz
-        x         x xx::x:xx  :: x:x:xxxxx::xxxx *xx :xxxxxxx:xxxx::  aa
+        x         x xx::x:xx  :: x:x:xxxxx::xxxx *xxx:xxxxxxx:xxxx::  aa
 \endverbatim
  *
  *  * Note that 'o' options arguments cannot be included here due to issues
@@ -196,9 +197,9 @@ cmdlineopts::s_long_options [] =
  */
 
 #if defined SEQ66_JACK_SUPPORT      // how to handle no SEQ66_NSM_SUPPORT?
-#define CMD_OPTS "09#AaB:b:Cc:DdF:f:gH:hI:iJjKkL:l:M:mNnoPpq:RrSsTtU:uVvWwX:x:Zz#"
+#define CMD_OPTS "09#AaB:b:Cc:DdF:f:gH:hI:iJjKkL:l:M:mNnoPpQq:RrSsTtU:uVvWwX:x:Zz#"
 #else
-#define CMD_OPTS "0#AaB:b:c:DdF:f:H:hI:iKkL:l:M:mnoPpq:RrsTuVvX:x:Zz#"
+#define CMD_OPTS "0#AaB:b:c:DdF:f:H:hI:iKkL:l:M:mnoPpQq:RrsTuVvX:x:Zz#"
 #endif
 
 const std::string cmdlineopts::s_arg_list = CMD_OPTS;
@@ -212,6 +213,7 @@ static const std::string s_help_1a =
 "   -h, --help, ?            Show this help and exit.\n"
 "   -V, --version, #         Show program version/build and exit.\n"
 "   -v, --verbose            Verbose mode, show more data to the console.\n"
+"   -Q, --quiet              Show only warnings and errors on the console.\n"
 #if defined SEQ66_NSM_SUPPORT
 "   -n, --nsm                Activate Non/New Session Manager support.\n"
 "   -T, --no-nsm             Ignore NSM in 'usr' file. T for 'typical'.\n"
@@ -321,10 +323,17 @@ static const std::string s_help_4b =
 "      mutes=value   Saving of mute-groups: 'mutes', 'midi', or 'both'.\n"
 "      virtual=o,i   Like --manual-ports, except that the count of output and\n"
 "                    input ports are specified. Defaults are 8 & 4.\n"
+"      null-midi     Use an in-process MIDI API with virtual ports instead\n"
+"                    of ALSA or JACK; output is captured, not sent.\n"
+"      null-script=f Implies null-midi. Feed timed input events from file f.\n"
+"      null-log=f    Implies null-midi. Write the captured output, and its\n"
+"                    latency and jitter, to file f at exit.\n"
 "\n"
 " seq66cli:\n"
 "      daemonize     Makes this application fork to the background.\n"
 "      no-daemonize  Or not.  These options do not apply to Windows.\n"
+"      bounce=file   Render the song of the given MIDI file to 'file', as\n"
+"                    fast as possible, and exit.\n"
 "\n"
 "'daemonize' works only in the CLI build. 'sets' works in all builds. Add\n"
 "'--user-save' to make these options permanent in the qseq66.usr file.\n"
@@ -500,6 +509,11 @@ cmdlineopts::parse_o_options (int argc, char * argv [])
                                 result = true;
                                 usr().option_daemonize(false);
                             }
+                            else if (arg == "null-midi")
+                            {
+                                result = true;
+                                rc().with_null_midi(true);
+                            }
                             else if (arg == "log")
                             {
                                 /*
@@ -544,6 +558,25 @@ cmdlineopts::parse_o_options (int argc, char * argv [])
                             {
                                 result = parse_o_virtual(arg);
                             }
+                            else if (optionname == "bounce")
+                            {
+                                arg = strip_quotes(arg);
+                                result = ! arg.empty();
+                                if (result)
+                                    usr().option_bounce(arg);
+                            }
+                            else if (optionname == "null-script")
+                            {
+                                result = true;
+                                rc().with_null_midi(true);
+                                rc().null_midi_script(strip_quotes(arg));
+                            }
+                            else if (optionname == "null-log")
+                            {
+                                result = true;
+                                rc().with_null_midi(true);
+                                rc().null_midi_log(strip_quotes(arg));
+                            }
                         }
                         if (! result)
                         {
@@ -1001,6 +1034,10 @@ cmdlineopts::parse_command_line_options (int argc, char * argv [])
             rc().priority(true);
             break;
 
+        case 'Q':
+            set_quiet(true);
+            break;
+
         case 'q':
             usr().midi_ppqn(string_to_int(soptarg));
             break;
@@ -106,6 +106,9 @@ configfile::configfile
     m_name              (name),
     m_version           ("0"),
     m_file_version      ("0"),
+    m_sections          (),
+    m_index_stream      (nullptr),
+    m_index_line_count  (0),
     m_line              (),
     m_line_number       (0),
     m_line_pos          (0)
@@ -265,6 +268,142 @@ configfile::get_line (std::ifstream & file, bool strip)
     return result;
 }
 
+/**
+ *  Reads the whole file once, noting the position and line number of each
+ *  section-marker line (one starting with "[").  Then the section lookups
+ *  can seek straight to a section, instead of rescanning the file from the
+ *  top for every section and variable.  Each parse() function calls this
+ *  function via an index_guard right after opening the file, so that the
+ *  index is dropped when parsing ends and a stale index is never used.
+ *
+ * \param file
+ *      The input stream to be indexed.  It is left at the beginning.
+ *
+ * \return
+ *      Returns true if at least one section was found.
+ */
+
+bool
+configfile::index_sections (std::ifstream & file)
+{
+    m_sections.clear();
+    m_index_stream = &file;
+    file.clear();
+    file.seekg(0, std::ios::beg);
+    m_line_number = 0;
+
+    bool ok = get_line(file, true);
+    while (ok)
+    {
+        if (m_line[0] == '[')
+            m_sections.push_back({m_line, m_line_pos, m_line_number});
+
+        ok = get_line(file, true);
+    }
+    m_index_line_count = m_line_number;
+    file.clear();
+    file.seekg(0, std::ios::beg);
+    m_line_number = 0;
+    m_line.clear();
+    return ! m_sections.empty();
+}
+
+/**
+ *  Drops the section index, so that no stream uses it.
+ */
+
+void
+configfile::clear_index ()
+{
+    m_sections.clear();
+    m_index_stream = nullptr;
+    m_index_line_count = 0;
+}
+
+/**
+ *  Provides the line number to start counting from when a stream is read
+ *  from a position, so that the line numbers are the same as those set when
+ *  the index is used.  The positions passed to line_after() come from
+ *  find_tag(), and are those of section-marker lines.
+ *
+ * \param file
+ *      The input stream.
+ *
+ * \param pos
+ *      The position from which the stream is to be read.
+ *
+ * \return
+ *      Returns the number of lines before the position, if the stream is
+ *      indexed and the position is that of a section marker, and 0
+ *      otherwise.
+ */
+
+int
+configfile::index_line_number
+(
+    const std::ifstream & file,
+    std::streampos pos
+) const
+{
+    if (&file == m_index_stream && pos != std::streampos(0))
+    {
+        for (const auto & sm : m_sections)
+        {
+            if (sm.sm_pos == pos)
+                return sm.sm_line_number - 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *  Uses the section index to go to a section-marker line, leaving the
+ *  stream and m_line as if the file had been scanned line by line to find
+ *  it.  If not found, the stream is left at the end, as a scan would leave
+ *  it.
+ *
+ * \param file
+ *      The input stream, which must be the one indexed.
+ *
+ * \param tag
+ *      The tag to be found.  The comparison is the same as in line_after().
+ *
+ * \param from
+ *      The stream position at which the scan would have started.
+ *
+ * \return
+ *      Returns true if the tag was found.
+ */
+
+bool
+configfile::seek_section
+(
+    std::ifstream & file,
+    const std::string & tag,
+    std::streampos from
+)
+{
+    bool result = false;
+    file.clear();
+    for (const auto & sm : m_sections)
+    {
+        if (sm.sm_pos >= from && strncompare(sm.sm_tag, tag))
+        {
+            file.seekg(sm.sm_pos);
+            m_line_number = sm.sm_line_number - 1;
+            result = get_line(file, true);
+            break;
+        }
+    }
+    if (! result)
+    {
+        file.seekg(0, std::ios::end);
+        m_line_number = m_index_line_count;
+        (void) get_line(file, true);            /* sets EOF, clears m_line  */
+    }
+    return result;
+}
+
 /**
  *  Gets the next line of data from an input stream.  If the line starts with
  *  a number-sign, or a null, it is skipped, to try the next line.  This
@@ -695,6 +834,10 @@ configfile::next_section (std::ifstream & file, const std::string & tag)
     {
         result = true;
     }
+    else if (use_index(file, tag))
+    {
+        result = seek_section(file, tag, file.tellg());
+    }
     else
     {
         bool ok = get_line(file);       /* fills in m_line as a side-effect */
@@ -765,9 +908,13 @@ configfile::line_after
 )
 {
     bool result = false;
+    if (use_index(file, tag))
+        return seek_section(file, tag, std::streampos(position)) &&
+            next_data_line(file, strip);
+
     file.clear();                               /* clear the file flags     */
     file.seekg(std::streampos(position), std::ios::beg); /* seek to spot    */
-    m_line_number = 0;                          /* back to beginning        */
+    m_line_number = index_line_number(file, std::streampos(position));
 
     bool ok = get_line(file, true);             /* trims spaces/comments    */
     while (ok)                                  /* includes the EOF check   */
@@ -813,6 +960,13 @@ int
 configfile::find_tag (std::ifstream & file, const std::string & tag)
 {
     int result = (-1);
+    if (use_index(file, tag))
+    {
+        if (seek_section(file, tag, std::streampos(0)))
+            result = line_position();           /* int(m_line_pos)          */
+
+        return result;
+    }
     file.clear();                               /* clear the file flags     */
     file.seekg(0, std::ios::beg);               /* seek to the beginning    */
     m_line_number = 0;                          /* back to beginning        */
@@ -912,8 +1066,6 @@ configfile::set_up_ifstream (std::ifstream & instream)
     bool result = instream.is_open();
     if (result)
     {
-        instream.seekg(0, std::ios::beg);                   /* seek to start */
-
         std::string s = get_variable(instream, "[Seq66]", "version");
         if (s.empty())
         {
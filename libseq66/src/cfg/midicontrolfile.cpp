@@ -232,7 +232,7 @@ bool
 midicontrolfile::parse_stream (std::ifstream & file)
 {
     bool result = true;
-    file.seekg(0, std::ios::beg);                   /* seek to the start    */
+    index_guard indexed(*this, file);               /* seeks to start   */
     (void) parse_version(file);
 
     std::string s = parse_comments(file);
@@ -485,6 +485,9 @@ midicontrolfile::parse_midi_control_out (std::ifstream & file)
     else
         enabled = string_to_bool(s);
 
+    s = get_variable(file, mctag, "messages-per-second");
+    int rate = string_to_int(s, 0);         /* 0 = no feedback rate limit   */
+
     /*
      * We need to read them anyway, for saving back at exit.  The enabled-flag
      * will determine if they are used.
@@ -515,6 +518,7 @@ midicontrolfile::parse_midi_control_out (std::ifstream & file)
             mco.configure_enabled(enabled);
             mco.offset(offset);
             mco.configured_buss(buss);
+            mco.feedback_rate(rate);
         }
         if (file_version_number() < 2)
         {
@@ -1039,6 +1043,14 @@ midicontrolfile::write_midi_control_out (std::ofstream & file)
         write_integer(file, "button-columns", mco.columns());
         file <<
 "\n"
+"# Status messages are coalesced and only changes are sent, once per input\n"
+"# cycle.  If non-zero, messages-per-second limits the rate of sending, for\n"
+"# devices that can overflow.\n"
+"\n"
+            ;
+        write_integer(file, "messages-per-second", mco.feedback_rate());
+        file <<
+"\n"
 "[midi-control-out]\n"
 "\n"
 "# This section determines how pattern statuses are to be displayed.\n"
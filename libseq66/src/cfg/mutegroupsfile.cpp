@@ -112,7 +112,7 @@ bool
 mutegroupsfile::parse_stream (std::ifstream & file)
 {
     bool result = true;
-    file.seekg(0, std::ios::beg);                   /* seek to start    */
+    index_guard indexed(*this, file);               /* seeks to start   */
     (void) parse_version(file);
 
     std::string s = parse_comments(file);
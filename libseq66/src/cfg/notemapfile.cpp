@@ -35,6 +35,7 @@
 
 #include "cfg/notemapfile.hpp"          /* seq66::notemapfile class         */
 #include "cfg/settings.hpp"             /* seq66::rcsettings & seq66::rc()  */
+#include "util/filefunctions.hpp"       /* seq66::file_readable()           */
 
 /*
  *  Do not document a namespace; it breaks Doxygen.
@@ -97,7 +98,7 @@ bool
 notemapfile::parse_stream (std::ifstream & file)
 {
     bool result = true;
-    file.seekg(0, std::ios::beg);                   /* seek to start    */
+    index_guard indexed(*this, file);               /* seeks to start   */
     (void) parse_version(file);
 
     std::string s = parse_comments(file);
@@ -388,6 +389,48 @@ copy_notemapper
     return result;
 }
 
+/**
+ *  This function reads a notemapper file.  Besides the notemapper and the
+ *  error message, it reads the 'rc' settings, and the parser sets the static
+ *  configfile error message.  So it can be called in a thread of its own
+ *  only while the 'rc' settings are not changed and no other configuration
+ *  file is parsed.
+ *
+ *  \param [out] nm
+ *      Provides the notemapper object to be filled.
+ *
+ *  \param source
+ *      Provides the input file name from which the notemapper will be filled.
+ *
+ *  \param [out] errmsg
+ *      Holds the error message, if any.
+ *
+ * \return
+ *      Returns true if the operation succeeded.
+ */
+
+bool
+read_notemapper
+(
+    notemapper & nm,
+    const std::string & source,
+    std::string & errmsg
+)
+{
+    bool result = file_readable(source);
+    if (result)
+    {
+        notemapfile nmf(nm, source, rc());
+        result = nmf.parse();
+        if (! result)
+            errmsg = nmf.get_error_message();
+    }
+    else
+        errmsg = "Cannot read: " + source;
+
+    return result;
+}
+
 }           // namespace seq66
 
 /*
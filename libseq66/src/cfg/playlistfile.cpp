@@ -156,7 +156,7 @@ playlistfile::open (bool verify_it)
                     msglevel::status, "Verifying playlist %s", name().c_str()
                 );
             }
-            result = play_list().verify();                  /* weak verify  */
+            result = play_list().verify(false, true);       /* weak, lazy   */
         }
     }
     play_list().mode(result);
@@ -211,7 +211,7 @@ playlistfile::parse ()
     if (result)
     {
         file_message("Reading playlist", name());
-        file.seekg(0, std::ios::beg);                   /* seek to start    */
+        index_guard indexed(*this, file);               /* seeks to start   */
         play_list().clear();
         (void) parse_version(file);
 
@@ -330,6 +330,7 @@ playlistfile::parse ()
                     plist.ls_index = listcount;         /* ordinal      */
                     plist.ls_midi_number = listnumber;  /* MIDI mapping */
                     plist.ls_song_count = songcount;
+                    plist.ls_verified = false;
                     plist.ls_song_list = slist;         /* copy temp    */
                     result = play_list().add_list(plist);
                 }
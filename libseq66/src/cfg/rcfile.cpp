@@ -42,6 +42,7 @@
  */
 
 #include <iomanip>                      /* std::setw() I/O manipulator      */
+#include <sstream>                      /* std::ostringstream               */
 
 #include "cfg/midicontrolfile.hpp"      /* seq66::midicontrolfile class     */
 #include "cfg/rcfile.hpp"               /* seq66::rcfile class              */
@@ -204,6 +205,7 @@ bool
 rcfile::parse ()
 {
     std::ifstream file(name(), std::ios::in | std::ios::ate);
+    index_guard indexed(*this, file);       /* dropped when parse ends  */
     if (! set_up_ifstream(file))            /* verifies [Seq66]: version    */
         return false;
 
@@ -306,6 +308,8 @@ rcfile::parse ()
         rc_ref().jack_auto_connect(flag);
         flag = get_boolean(file, tag, "jack-use-offset", 0, true);
         rc_ref().jack_use_offset(flag);
+        flag = get_boolean(file, tag, "jack-cycle-sync");
+        rc_ref().jack_cycle_sync(flag);
 
         int buffersize = rc().jack_buffer_size();
         buffersize = get_integer(file, tag, "jack-buffer-size", 0);
@@ -321,6 +325,19 @@ rcfile::parse ()
     rc_ref().manual_port_count(count);
     count = get_integer(file, tag, "input-port-count");
     rc_ref().manual_in_port_count(count);
+    flag = get_boolean(file, tag, "null-midi");
+    rc_ref().with_null_midi(flag);
+
+    std::string nullfile = get_variable(file, tag, "null-midi-script");
+    if (is_missing_string(nullfile))
+        nullfile.clear();
+
+    rc_ref().null_midi_script(nullfile);
+    nullfile = get_variable(file, tag, "null-midi-log");
+    if (is_missing_string(nullfile))
+        nullfile.clear();
+
+    rc_ref().null_midi_log(nullfile);
 
     /*
      *  When Seq66 exits, it saves all of the inputs it has.  If an input is
@@ -386,6 +403,73 @@ rcfile::parse ()
         infoprintf("%d midi-input-map entries added", count);
     }
 
+    /*
+     *  Check for an optional input latency section.  Each data line holds
+     *  the input buss number and its latency offset in milliseconds.
+     */
+
+    tag = "[midi-input-latency]";
+    if (line_after(file, tag))
+    {
+        int count = 0;
+        do
+        {
+            int bus;
+            float ms;
+            if (std::sscanf(scanline(), "%d %f", &bus, &ms) == 2)
+            {
+                if (bus >= 0 && is_good_buss(bussbyte(bus)))
+                {
+                    rc_ref().input_latency_us(bussbyte(bus), int(ms * 1000.0));
+                    ++count;
+                }
+            }
+        } while (next_data_line(file));
+        infoprintf("%d midi-input-latency entries added", count);
+    }
+
+    /*
+     *  Check for an optional direct thru section.  Each data line holds the
+     *  input buss and channel, the output buss and channel, and a flag to
+     *  map the notes with the note-mapper.  A channel of -1 means "any" on
+     *  input, and "same" on output.
+     */
+
+    tag = "[midi-thru-routes]";
+    if (line_after(file, tag))
+    {
+        int count = 0;
+        do
+        {
+            int inbus, inchan, outbus, outchan, mapnotes;
+            int n = std::sscanf
+            (
+                scanline(), "%d %d %d %d %d",
+                &inbus, &inchan, &outbus, &outchan, &mapnotes
+            );
+            if (n >= 4)
+            {
+                bool ok = inbus >= 0 && is_good_buss(bussbyte(inbus)) &&
+                    outbus >= 0 && is_good_buss(bussbyte(outbus)) &&
+                    inchan >= (-1) && inchan < 16 &&
+                    outchan >= (-1) && outchan < 16;
+
+                if (ok)
+                {
+                    midithru::route r;
+                    r.mtr_in_buss = bussbyte(inbus);
+                    r.mtr_in_channel = inchan;
+                    r.mtr_out_buss = bussbyte(outbus);
+                    r.mtr_out_channel = outchan;
+                    r.mtr_map_notes = n == 5 && mapnotes != 0;
+                    rc_ref().add_thru_route(r);
+                    ++count;
+                }
+            }
+        } while (next_data_line(file));
+        infoprintf("%d midi-thru-routes entries added", count);
+    }
+
     /*
      * One thing about MIDI clock values.  If a device (e.g. Korg nanoKEY2)
      * is present in a system when Seq66 is exited, it will be saved in the
@@ -521,6 +605,14 @@ rcfile::parse ()
         rc_ref().reveal_ports(bool(flag));
     }
 
+    tag = "[midi-panic]";
+    if (line_after(file, tag))
+    {
+        bool flag = get_boolean(file, tag, "channel-mode-messages");
+        rc_ref().panic_channel_mode(flag);
+        rc_ref().panic_rate(get_integer(file, tag, "messages-per-second"));
+    }
+
     /*
      * New for issue #97, add a configurable metronome function.
      */
@@ -842,11 +934,21 @@ rcfile::write ()
 "# to other clients. It allows up to 48 output or input ports (defaults to 8\n"
 "# and 4). Set to false to auto-connect Seq66 to the existing ALSA/JACK MIDI\n"
 "# ports.\n"
+"#\n"
+"# null-midi replaces ALSA/JACK with an in-process MIDI API that needs no\n"
+"# server, for testing and benchmarking. It always uses virtual ports. Output\n"
+"# is captured with timestamps and written to null-midi-log at exit, along\n"
+"# with latency and jitter figures. null-midi-script names a text file of\n"
+"# input events, one per line: 'microseconds buss status [data [data]]', in\n"
+"# decimal or 0x hex, timed from port activation.\n"
 "\n[manual-ports]\n\n"
         ;
     write_boolean(file, "virtual-ports", rc_ref().manual_ports());
     write_integer(file, "output-port-count", rc_ref().manual_port_count());
     write_integer(file, "input-port-count", rc_ref().manual_in_port_count());
+    write_boolean(file, "null-midi", rc_ref().with_null_midi());
+    write_string(file, "null-midi-script", rc_ref().null_midi_script(), true);
+    write_string(file, "null-midi-log", rc_ref().null_midi_log(), true);
 
     int inbuses = bussbyte(rc_ref().inputs().count());
     file << "\n"
@@ -881,6 +983,48 @@ rcfile::write ()
         ;
     }
 
+    const auto & latencies = rc_ref().input_latencies();
+    if (! latencies.empty())
+    {
+        file << "\n"
+"# Optional input latency offsets. Each line has the input bus number and the\n"
+"# latency of that port in milliseconds, subtracted from the time at which\n"
+"# incoming events are recorded. Use it to align a slow device or interface.\n"
+"# JACK input is also corrected by the age of each event; ALSA is not.\n\n"
+"[midi-input-latency]\n\n"
+            ;
+        for (const auto & lat : latencies)
+        {
+            std::ostringstream ms;              /* keeps file's float format */
+            ms << std::fixed << std::setprecision(2)
+                << double(lat.second) / 1000.0;
+
+            file << std::setw(2) << int(lat.first) << " " << ms.str() << "\n";
+        }
+    }
+
+    const auto & routes = rc_ref().thru_routes();
+    if (! routes.empty())
+    {
+        file << "\n"
+"# Optional direct thru routes, applied in the JACK process callback without\n"
+"# passing through the input and output threads. Each line has the input bus,\n"
+"# input channel (-1 = any), output bus, output channel (-1 = same), and 1 to\n"
+"# map notes with the note-mapper ('drums' file). Not supported with ALSA.\n\n"
+"[midi-thru-routes]\n\n"
+            ;
+        for (const auto & r : routes)
+        {
+            file
+                << std::setw(2) << int(r.mtr_in_buss) << " "
+                << std::setw(2) << r.mtr_in_channel << " "
+                << std::setw(2) << int(r.mtr_out_buss) << " "
+                << std::setw(2) << r.mtr_out_channel << " "
+                << (r.mtr_map_notes ? 1 : 0) << "\n"
+                ;
+        }
+    }
+
     /*
      * Bus mute/unmute data.  At this point, we can use the master_bus()
      * accessor, even if a pointer dereference, because it was created at
@@ -968,6 +1112,20 @@ rcfile::write ()
        ;
     write_boolean(file, "show-system-ports", rc_ref().reveal_ports());
 
+    /*
+     * Panic
+     */
+
+    file << "\n"
+"# Panic sends Note Off for the notes left sounding on each output port. Set\n"
+"# 'channel-mode-messages' to true to also send All Sound Off (CC 120) and All\n"
+"# Notes Off (CC 123) on each channel used. 'messages-per-second' limits the\n"
+"# rate per port, to avoid overrunning DIN MIDI ports; 0 means no limit.\n"
+"\n[midi-panic]\n\n"
+       ;
+    write_boolean(file, "channel-mode-messages", rc_ref().panic_channel_mode());
+    write_integer(file, "messages-per-second", rc_ref().panic_rate());
+
     /*
      * Metronome
      */
@@ -1104,6 +1262,9 @@ rcfile::write ()
 "# jack-use-offset attempts to calculate timestamp offsets to improve accuracy\n"
 "# at high-buffer sizes. Still a work in progress.\n"
 "# jack-buffer-size allows for changing the frame-count, a power of 2.\n"
+"# jack-cycle-sync paces playback by the JACK process cycle, using the transport\n"
+"# position of each cycle, instead of a free-running timer. Needs a transport-\n"
+"# type other than none.\n"
 "\n[jack-transport]\n\n"
         << "transport-type = " << jacktransporttype << "\n"
         << "song-start-mode = " << rc_ref().song_mode_string() << "\n"
@@ -1111,6 +1272,7 @@ rcfile::write ()
     write_boolean(file, "jack-midi", rc_ref().with_jack_midi());
     write_boolean(file, "jack-auto-connect", rc_ref().jack_auto_connect());
     write_boolean(file, "jack-use-offset", rc_ref().jack_use_offset());
+    write_boolean(file, "jack-cycle-sync", rc_ref().jack_cycle_sync());
     write_integer(file, "jack-buffer-size", rc_ref().jack_buffer_size());
     file << "\n"
 "# 'auto-save-rc' sets automatic saving of the  'rc' and other files. If set,\n"
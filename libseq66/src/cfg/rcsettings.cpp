@@ -62,6 +62,8 @@ rcsettings::rcsettings () :
     basesettings                (),
     m_clocks                    (),         /* vector wrapper class     */
     m_inputs                    (),         /* vector wrapper class     */
+    m_input_latencies           (),
+    m_thru_routes               (),
     m_metro_settings            (),
     m_mute_group_save           (mutegroups::saving::both),
     m_keycontainer              ("rc"),
@@ -92,13 +94,19 @@ rcsettings::rcsettings () :
 #endif
     m_jack_auto_connect         (true),
     m_jack_use_offset           (true),
+    m_jack_cycle_sync           (false),
     m_jack_buffer_size          (0),
     m_song_start_mode           (sequence::playback::automatic),
     m_song_start_is_auto        (true),
     m_manual_ports              (false),
     m_manual_port_count         (c_output_buss_default),
     m_manual_in_port_count      (c_input_buss_default),
+    m_with_null_midi            (false),
+    m_null_midi_script          (),
+    m_null_midi_log             (),
     m_reveal_ports              (false),
+    m_panic_channel_mode        (false),
+    m_panic_rate                (1000),     /* about a DIN port's limit */
     m_init_disabled_ports       (false),
     m_print_keys                (false),
     m_interaction_method        (interaction::seq24),
@@ -162,6 +170,8 @@ rcsettings::set_defaults ()
      */
 
     m_metro_settings.set_defaults();
+    m_input_latencies.clear();
+    m_thru_routes.clear();
 
     /*
      * m_mute_groups.clear();
@@ -199,13 +209,19 @@ rcsettings::set_defaults ()
 #endif
     m_jack_auto_connect         = true;
     m_jack_use_offset           = true;
+    m_jack_cycle_sync           = false;
     m_jack_buffer_size          = 0;
     m_song_start_mode           = sequence::playback::automatic;
     m_song_start_is_auto        = true;
     m_manual_ports              = false;
     m_manual_port_count         = c_output_buss_default;
     m_manual_in_port_count      = c_input_buss_default;
+    m_with_null_midi            = false;
+    m_null_midi_script.clear();
+    m_null_midi_log.clear();
     m_reveal_ports              = false;
+    m_panic_channel_mode        = false;
+    m_panic_rate                = 1000;
     m_init_disabled_ports       = false;
     m_print_keys                = false;
     m_interaction_method        = interaction::seq24;
@@ -111,6 +111,7 @@ sessionfile::parse ()
 {
     bool result = false;
     std::ifstream file(name(), std::ios::in | std::ios::ate);
+    index_guard indexed(*this, file);       /* dropped when parse ends  */
     if (set_up_ifstream(file))            /* verifies [Seq66]: version    */
     {
         std::string tag = tag_name();
@@ -134,6 +134,7 @@ bool
 usrfile::parse ()
 {
     std::ifstream file(name().c_str(), std::ios::in | std::ios::ate);
+    index_guard indexed(*this, file);       /* dropped when parse ends  */
     if (! set_up_ifstream(file))            /* verifies [Seq66]: version    */
         return false;
 
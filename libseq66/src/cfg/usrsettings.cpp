@@ -367,6 +367,7 @@ usrsettings::usrsettings () :
     m_user_option_daemonize     (false),
     m_user_use_logfile          (false),
     m_user_option_logfile       (),
+    m_user_option_bounce        (),
     m_user_pdf_viewer           (),
     m_user_browser              (),
 
@@ -464,6 +465,7 @@ usrsettings::set_defaults ()
     m_user_option_daemonize = false;
     m_user_use_logfile = false;
     m_user_option_logfile.clear();
+    m_user_option_bounce.clear();
     m_user_pdf_viewer.clear();
     m_user_browser.clear();
     m_user_ui_key_height = c_def_key_height;
@@ -85,6 +85,34 @@
 namespace seq66
 {
 
+/**
+ *  The dispatch table covers the channel messages, status 0x80 to 0xEF, each
+ *  with 128 values of d0.
+ */
+
+static const int c_dispatch_status_min = 0x80;
+static const int c_dispatch_status_max = 0xF0;
+static const int c_dispatch_size =
+    (c_dispatch_status_max - c_dispatch_status_min) * c_midibyte_data_max;
+
+/**
+ *  Calculates the dispatch-table index of a control key.
+ *
+ * \return
+ *      Returns the index, or -1 if the key is not a channel message.
+ */
+
+static int
+dispatch_index (const midicontrol::key & k)
+{
+    int status = int(k.status());
+    int d0 = int(k.d0());
+    bool ok = status >= c_dispatch_status_min &&
+        status < c_dispatch_status_max && d0 < c_midibyte_data_max;
+
+    return ok ? (status - c_dispatch_status_min) * c_midibyte_data_max + d0 : -1 ;
+}
+
 /**
  *  This constructor assigns the basic values of control name, number, and
  *  action code.  The rest of the members can be set via the set() function.
@@ -93,6 +121,8 @@ namespace seq66
 midicontrolin::midicontrolin (const std::string & name) :
     midicontrolbase     (name),
     m_container         (),
+    m_dispatch_table    (),
+    m_dispatch_controls (),
     m_comments_block    (),
     m_control_status    (automation::ctrlstatus::none),
     m_have_controls     (false)
@@ -136,6 +166,20 @@ midicontrolin::add (const midicontrol & mc)
     {
         if (! mc.blank())
             m_have_controls = true;
+
+        int index = dispatch_index(k);
+        if (index >= 0)
+        {
+            if (m_dispatch_table.empty())
+                m_dispatch_table.resize(c_dispatch_size, 0);
+
+            if (m_dispatch_table[index] == 0)       /* first one is found   */
+            {
+                m_dispatch_controls.push_back(mc);
+                m_dispatch_table[index] =
+                    (unsigned short)(m_dispatch_controls.size());
+            }
+        }
     }
     else
     {
@@ -183,6 +227,9 @@ midicontrolin::add_blank_controls (const keycontainer & kc)
  *  now part of the key, not for operator <, but for checking the source of
  *  the event.  The source should match this container's true buss, if it
  *  isn't the "null" buss (0xFF).
+ *
+ *  Channel messages, which is what control surfaces send, are looked up in
+ *  the dispatch table; only other statuses need the multimap search.
  */
 
 const midicontrol &
@@ -192,6 +239,19 @@ midicontrolin::control (const midicontrol::key & k) const
     bool ok = have_controls();
     if (ok)
     {
+        int index = dispatch_index(k);
+        if (index >= 0)
+        {
+            unsigned short entry = m_dispatch_table.empty() ?
+                0 : m_dispatch_table[index] ;
+
+            ok = entry > 0;
+            if (ok)
+                ok = is_null_buss(nominal_buss()) || k.buss() == true_buss();
+
+            return ok ? m_dispatch_controls[entry - 1] : sm_midicontrol_dummy;
+        }
+
         const auto & cki = m_container.find(k);
         ok = cki != m_container.end();
         if (ok)
@@ -34,11 +34,13 @@
  * sequences.
  */
 
+#include <algorithm>                    /* std::fill(), std::min()          */
 #include <iomanip>                      /* std::setw() manipulator          */
 #include <sstream>                      /* std::ostringstream class         */
 
 #include "ctrl/midicontrolout.hpp"      /* seq66::midicontrolout class      */
 #include "play/mutegroups.hpp"          /* seq66::mutegroups::Size()        */
+#include "os/timing.hpp"                /* seq66::microtime()               */
 
 /*
  *  Do not document a namespace; it breaks Doxygen.
@@ -47,6 +49,182 @@
 namespace seq66
 {
 
+/**
+ *  The number of feedback addresses:  the Note (On and Off sharing an
+ *  address), Aftertouch, and Control Change messages, times 16 channels,
+ *  times 128 values of d0.  Program Change, Channel Pressure, and Pitch Wheel
+ *  messages have no d0 that names a button, and are sent as is.
+ */
+
+static const int c_feedback_addresses = 4 * 16 * 128;
+
+/**
+ *  The largest burst of feedback messages allowed under a rate limit, in
+ *  milliseconds worth of the rate.
+ */
+
+static const int c_feedback_burst_ms = 20;
+
+/**
+ *  Calculates the feedback address of a status event.
+ *
+ * \param ev
+ *      The event to be sent to the control surface.
+ *
+ * \return
+ *      Returns the address, or -1 if the event is not of a coalescable kind.
+ */
+
+static int
+feedback_address (const event & ev)
+{
+    int result = -1;
+    midibyte status = ev.get_status();
+    int kind = int(status >> 4);
+    if (kind >= 0x8 && kind <= 0xB)
+    {
+        int channel = int(status & 0x0F);
+        midibyte d0;
+        ev.get_data(d0);
+        if (kind == 0x8)
+            kind = 0x9;                             /* Note Off is a Note   */
+
+        result = ((kind - 0x8) * 16 + channel) * 128 + int(d0 & 0x7F);
+    }
+    return result;
+}
+
+midicontrolout::feedback::feedback () :
+    m_shadow    (c_feedback_addresses, 0),
+    m_wanted    (c_feedback_addresses, 0),
+    m_dirty     (),
+    m_queued    (c_feedback_addresses, false),
+    m_pending   (false),
+    m_mutex     ()
+{
+    m_dirty.reserve(c_feedback_addresses);
+}
+
+midicontrolout::feedback::feedback (const feedback & rhs) :
+    m_shadow    (),
+    m_wanted    (),
+    m_dirty     (),
+    m_queued    (),
+    m_pending   (false),
+    m_mutex     ()
+{
+    *this = rhs;
+}
+
+midicontrolout::feedback &
+midicontrolout::feedback::operator = (const feedback & rhs)
+{
+    if (this != &rhs)
+    {
+        std::lock(m_mutex, rhs.m_mutex);
+        std::lock_guard<std::mutex> lk1(m_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lk2(rhs.m_mutex, std::adopt_lock);
+        m_shadow = rhs.m_shadow;
+        m_wanted = rhs.m_wanted;
+        m_dirty = rhs.m_dirty;
+        m_queued = rhs.m_queued;
+        m_pending = bool(rhs.m_pending);
+    }
+    return *this;
+}
+
+/**
+ *  Records the wanted state of the address of an event.  If the address is
+ *  already waiting to be sent, only its state is replaced, so that a button
+ *  set several times between drains is sent once, in its latest state.
+ *
+ * \param ev
+ *      The status event to be sent eventually.
+ *
+ * \return
+ *      Returns false if the event has no feedback address; the caller must
+ *      then send it directly.
+ */
+
+bool
+midicontrolout::feedback::post (const event & ev)
+{
+    int a = feedback_address(ev);
+    bool result = a >= 0;
+    if (result)
+    {
+        midibyte d0, d1;
+        ev.get_data(d0, d1);
+
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_wanted[a] = (unsigned short)(ev.get_status()) << 8 | d1;
+        if (! m_queued[a])
+        {
+            m_queued[a] = true;
+            m_dirty.push_back((unsigned short)(a));
+            m_pending = true;
+        }
+    }
+    return result;
+}
+
+/**
+ *  Moves the waiting states that differ from the device state into a list of
+ *  events, in the order they were first posted, and marks them as sent.
+ *  Waiting states that match the device state are dropped.
+ *
+ * \param evs
+ *      The destination of the events.  It is cleared first.
+ *
+ * \param limit
+ *      The maximum number of events to take.  If negative, there is no limit.
+ *
+ * \return
+ *      Returns the number of events taken.
+ */
+
+int
+midicontrolout::feedback::take (std::vector<event> & evs, int limit)
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    int count = 0;
+    std::size_t i = 0;
+    evs.clear();
+    for ( ; i < m_dirty.size(); ++i)
+    {
+        if (limit >= 0 && count >= limit)
+            break;
+
+        int a = int(m_dirty[i]);
+        unsigned short state = m_wanted[a];
+        m_queued[a] = false;
+        if (state != m_shadow[a])
+        {
+            midibyte status = midibyte(state >> 8);
+            midibyte d0 = midibyte(a & 0x7F);
+            midibyte d1 = midibyte(state & 0x7F);
+            evs.push_back(event(0, status, d0, d1));
+            m_shadow[a] = state;
+            ++count;
+        }
+    }
+    m_dirty.erase(m_dirty.begin(), m_dirty.begin() + i);
+    m_pending = ! m_dirty.empty();
+    return count;
+}
+
+/**
+ *  Marks the state of the device as unknown, so that the next state posted
+ *  to every address is sent.
+ */
+
+void
+midicontrolout::feedback::forget ()
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    std::fill(m_shadow.begin(), m_shadow.end(), 0);
+}
+
 /**
  *  This constructor assigns the basic values of control name, number, and
  *  action code.  The rest of the members can be set via the set() function.
@@ -59,7 +237,11 @@ midicontrolout::midicontrolout (const std::string & name) :
     m_ui_events         (),
     m_mutes_events      (),
     m_macro_events      (),
-    m_screenset_size    (0)
+    m_screenset_size    (0),
+    m_feedback          (),
+    m_feedback_rate     (0),
+    m_feedback_budget   (0.0),
+    m_feedback_time     (0)
 {
    // no code
 }
@@ -93,6 +275,7 @@ midicontrolout::initialize (int buss, int rows, int columns)
     m_seq_events.clear();
     m_ui_events.clear();
     m_mutes_events.clear();
+    m_feedback = feedback();
     if (result)
     {
         int count = rows * columns;
@@ -264,16 +447,68 @@ midicontrolout::send_seq_event (int index, seqaction what, bool flush)
                     "send_seq_event(%s): %s\n", act.c_str(), evstring.c_str()
                 );
 #endif
-                bussbyte tb = true_buss();
-                if (flush)
-                    m_master_bus->play_and_flush(tb, &ev, ev.channel());
-                else
-                    m_master_bus->play(tb, &ev, ev.channel());
+                if (! m_feedback.post(ev))
+                {
+                    bussbyte tb = true_buss();
+                    if (flush)
+                        m_master_bus->play_and_flush(tb, &ev, ev.channel());
+                    else
+                        m_master_bus->play(tb, &ev, ev.channel());
+                }
             }
         }
     }
 }
 
+/**
+ *  Sends the status events posted since the last call, skipping those that
+ *  would not change the state of the device, and flushes the buss once.  This
+ *  function is called in each cycle of the input thread, so that the events
+ *  of a full-grid refresh (a set change, a mute-group, a playlist load) go
+ *  out as one batch, away from the output thread.  If a feedback rate is set,
+ *  events beyond the budget of the rate remain for later cycles.
+ *
+ * \param unlimited
+ *      If true, all waiting events are sent now, ignoring the rate.  Used
+ *      when clearing the device, and at exit.  Defaults to false.
+ */
+
+void
+midicontrolout::send_feedback (bool unlimited)
+{
+    if (! m_feedback.pending() || is_nullptr(m_master_bus))
+        return;
+
+    int limit = -1;
+    if (! unlimited && m_feedback_rate > 0)
+    {
+        long now = microtime();
+        double maxbudget = m_feedback_rate * c_feedback_burst_ms / 1000.0;
+        if (maxbudget < 1.0)
+            maxbudget = 1.0;
+
+        m_feedback_budget += (now - m_feedback_time) * m_feedback_rate / 1.0e6;
+        m_feedback_budget = std::min(m_feedback_budget, maxbudget);
+        m_feedback_time = now;
+        limit = int(m_feedback_budget);
+        if (limit == 0)
+            return;
+    }
+
+    std::vector<event> evs;
+    int count = m_feedback.take(evs, limit);
+    if (count > 0)
+    {
+        bussbyte tb = true_buss();
+        for (auto & ev : evs)
+            m_master_bus->play(tb, &ev, ev.channel());
+
+        m_master_bus->flush();
+        if (limit >= 0)
+            m_feedback_budget -= count;
+    }
+}
+
 /**
  *  Clears all visible sequences by sending "delete" messages for all
  *  sequences ranging from 0 to 31.
@@ -288,7 +523,10 @@ midicontrolout::clear_sequences (bool flush)
             send_seq_event(seq, midicontrolout::seqaction::removed, false);
 
         if (flush && not_nullptr(m_master_bus))
+        {
+            send_feedback(true);
             m_master_bus->flush();
+        }
     }
 }
 
@@ -301,7 +539,10 @@ midicontrolout::clear_mutes (bool flush)
             send_mutes_event(g, action_del);
 
         if (flush && not_nullptr(m_master_bus))
+        {
+            send_feedback(true);
             m_master_bus->flush();
+        }
     }
 }
 
@@ -406,7 +647,7 @@ midicontrolout::send_event (uiaction what, actionindex which)
         else
             ev = m_ui_events[w].att_action_event_del;
 
-        if (ev.valid_status())
+        if (ev.valid_status() && ! m_feedback.post(ev))
             m_master_bus->play_and_flush(true_buss(), &ev, ev.channel());
     }
 }
@@ -440,6 +681,7 @@ midicontrolout::send_macro (const std::string & name, bool flush)
         {
             int len = int(byts.length());
             bussbyte tb = true_buss();
+            send_feedback(true);                        /* keep the order   */
 
             /*
              * This test is inadequate.
@@ -463,6 +705,7 @@ midicontrolout::send_macro (const std::string & name, bool flush)
                 else
                     m_master_bus->play(tb, &ev, ev.channel());
             }
+            m_feedback.forget();                        /* device state?    */
         }
     }
 }
@@ -634,7 +877,10 @@ midicontrolout::send_mutes_event (int group, actionindex which)
             ev = m_mutes_events[group].att_action_event_del;
 
         if (ev.valid_status() && not_nullptr(m_master_bus))
-            m_master_bus->play_and_flush(true_buss(), &ev, ev.channel());
+        {
+            if (! m_feedback.post(ev))
+                m_master_bus->play_and_flush(true_buss(), &ev, ev.channel());
+        }
     }
 }
 
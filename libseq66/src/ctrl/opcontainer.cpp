@@ -42,13 +42,20 @@
 namespace seq66
 {
 
+/**
+ *  The number of operation slots, covering the automation slots and the
+ *  pattern and mute-group operation numbers that follow them.
+ */
+
+static const int c_opcontainer_size = int(automation::slot::illegal) + 1;
+
 /**
  *  This default constructor creates a "zero" object.  Every member is
  *  either false or some other form of zero.
  */
 
 opcontainer::opcontainer () :
-    m_container         (),
+    m_container         (c_opcontainer_size),
     m_container_name    ()
 {
     // Empty body
@@ -60,7 +67,7 @@ opcontainer::opcontainer () :
  */
 
 opcontainer::opcontainer (const std::string & name) :
-    m_container         (),
+    m_container         (c_opcontainer_size),
     m_container_name    (name)
 {
     // Empty body
@@ -89,15 +96,13 @@ opcontainer::add (const midioperation & op)
         opnumber != automation::slot::automation
     )
     {
-        opmap::size_type sz = m_container.size();
-
-        /*
-         * auto --> std::pair<automation::slot, midioperation>;
-         */
-
-        auto p = std::make_pair(opnumber, op);
-        (void) m_container.insert(p);
-        result = m_container.size() == (sz + 1);
+        int index = int(opnumber);
+        if (index >= 0 && index < int(m_container.size()))
+        {
+            result = ! m_container[index].is_usable();  /* no replacement   */
+            if (result)
+                m_container[index] = op;
+        }
     }
     return result;
 }
@@ -106,8 +111,9 @@ const midioperation &
 opcontainer::operation (automation::slot s) const
 {
     static midioperation sm_midioperation_dummy;
-    const auto & coi = m_container.find(s);
-    return (coi != m_container.end()) ? coi->second : sm_midioperation_dummy;
+    int index = int(s);
+    return index >= 0 && index < int(m_container.size()) ?
+        m_container[index] : sm_midioperation_dummy ;
 }
 
 void
@@ -117,13 +123,16 @@ opcontainer::show () const
     std::cout << "Op container size: " << m_container.size() << std::endl;
     for (const auto & oc : m_container)
     {
-        std::cout
-            << "[" << std::setw(2) << std::right << index << "] "
-            << opcontrol::automation_slot_name(oc.first) << ": "
-            ;
-
-        oc.second.show();
-        ++index;
+        if (oc.is_usable())
+        {
+            std::cout
+                << "[" << std::setw(2) << std::right << index << "] "
+                << opcontrol::automation_slot_name(oc.number()) << ": "
+                ;
+
+            oc.show();
+            ++index;
+        }
     }
 }
 
@@ -46,6 +46,8 @@
  *          businfo container.
  */
 
+#include <cstdint>                      /* std::int32_t, std::uint32_t      */
+
 #include "cfg/settings.hpp"             /* seq66::rc() and seq66::usr()     */
 #include "midi/businfo.hpp"             /* seq66::businfo class             */
 #include "midi/event.hpp"               /* seq66::event class               */
@@ -87,7 +89,9 @@ businfo::businfo (midibus * bus)
     m_active        (false),
     m_initialized   (false),
     m_init_clock    (e_clock::off),     /* could end up disabled as well    */
-    m_init_input    (false)
+    m_init_input    (false),
+    m_pending       (),
+    m_has_pending   (false)
 {
     m_bus.reset(bus);                   /* also see initialize()            */
 }
@@ -105,7 +109,9 @@ businfo::businfo (const businfo & rhs)
     m_active        (rhs.m_active),
     m_initialized   (rhs.m_initialized),
     m_init_clock    (rhs.m_init_clock),
-    m_init_input    (rhs.m_init_input)
+    m_init_input    (rhs.m_init_input),
+    m_pending       (rhs.m_pending),
+    m_has_pending   (rhs.m_has_pending)
 {
     // no other code needed
 }
@@ -240,7 +246,9 @@ businfo::print () const
  *  access than using arrays of booleans and pointers.
  */
 
-busarray::busarray () : m_container()
+busarray::busarray () :
+    m_container     (),
+    m_next_input    (0)
 {
     // Empty body
 }
@@ -674,6 +682,33 @@ busarray::get_input (bussbyte bus) const
     return result;
 }
 
+/**
+ *  Gets the age of an input event that arrived on the given buss.
+ *
+ * \param bus
+ *      Provides the buss number, as stored in the event by get_midi_event().
+ *
+ * \param stamp
+ *      Provides the arrival timestamp stored in the event by the input API.
+ *
+ * \return
+ *      Returns the age in microseconds, or 0 if the buss is not active or its
+ *      API does not timestamp input events.
+ */
+
+long
+busarray::input_age_us (bussbyte bus, midipulse stamp)
+{
+    long result = 0;
+    if (bus < count())
+    {
+        businfo & bi = m_container[bus];
+        if (bi.active())
+            result = bi.bus()->input_age_us(stamp);
+    }
+    return result;
+}
+
 /**
  *  Get the system-port status for the given (legal) buss number.
  *
@@ -699,17 +734,25 @@ busarray::is_system_port (bussbyte bus)
 }
 
 /**
- *  Initiate a poll() on the existing poll descriptors.  This is a primitive
- *  poll, which exits when some data is obtained.  It also applies only to the
- *  input busses.
- *
- *  One issue is that we have no way of knowing here which MIDI input device
- *  has MIDI input events waiting.  Should we randomize the order of polling
- *  in order to avoid starving some input devices?
+ *  Compares the arrival times of two input events.  The input drivers stamp
+ *  an event with a free-running counter (e.g. the JACK frame time), which
+ *  can wrap around at 32 bits, so the difference is taken modulo 2^32.
+ */
+
+static bool
+arrived_before (midipulse t0, midipulse t1)
+{
+    return std::int32_t(std::uint32_t(t0) - std::uint32_t(t1)) < 0;
+}
+
+/**
+ *  Initiate a poll() on the existing poll descriptors.  It applies only to
+ *  the input busses.  All of the busses are polled, so that the count
+ *  includes every bus, not just the first one with data.
  *
  * \return
- *      Returns the number of MIDI events detected on one of the busses.  Note
- *      that this is no longer a boolean value.
+ *      Returns the number of MIDI events waiting on all of the busses,
+ *      including the events already read ahead by get_midi_event().
  */
 
 int
@@ -718,18 +761,22 @@ busarray::poll_for_midi ()
     int result = 0;
     for (auto & bi : m_container)               /* vector of businfo copies */
     {
-        result = bi.bus()->poll_for_midi();
-        if (result > 0)
-            break;
+        if (bi.m_has_pending)
+            ++result;
+
+        result += bi.bus()->poll_for_midi();
     }
     return result;
 }
 
 /**
- *  Gets the first MIDI event in finds on an input bus.
- *
- *  Note that this function risks starving the second input device if more
- *  than one is enabled in Seq66.  We will figure that one out later.
+ *  Gets the earliest MIDI event waiting on the input busses.  Each bus keeps
+ *  one event read ahead; the event that arrived first is handed out, and its
+ *  bus then reads ahead its next event.  This is a k-way merge of the input
+ *  queues, which are each already in arrival order.  Events with the same
+ *  arrival time (including busses that do not provide one) are handed out
+ *  round-robin, so that a busy bus (e.g. a clock source) cannot starve the
+ *  others.
  *
  * \param inev
  *      A pointer to the event to be modified by incoming data, if any.
@@ -741,16 +788,52 @@ busarray::poll_for_midi ()
 bool
 busarray::get_midi_event (event * inev)
 {
-    for (auto & bi : m_container)               /* vector of businfo copies */
+    int buscount = count();
+    if (buscount == 0)
+        return false;
+
+    for (auto & bi : m_container)               /* read ahead, if needed    */
     {
-        if (bi.bus()->get_midi_event(inev))
+        if (! bi.m_has_pending && bi.bus()->get_midi_event(&bi.m_pending))
         {
             bussbyte b = bussbyte(bi.bus()->bus_index());
-            inev->set_input_bus(b);
-            return true;
+            bi.m_pending.set_input_bus(b);
+            bi.m_has_pending = true;
+        }
+    }
+
+    int earliest = (-1);
+    if (m_next_input >= buscount)
+        m_next_input = 0;
+
+    for (int i = 0; i < buscount; ++i)          /* start at the favored bus */
+    {
+        int index = (m_next_input + i) % buscount;
+        const businfo & bi = m_container[index];
+        if (bi.m_has_pending)
+        {
+            if (earliest < 0)
+            {
+                earliest = index;
+            }
+            else
+            {
+                midipulse t = bi.m_pending.timestamp();
+                midipulse te = m_container[earliest].m_pending.timestamp();
+                if (arrived_before(t, te))
+                    earliest = index;
+            }
         }
     }
-    return false;
+    bool result = earliest >= 0;
+    if (result)
+    {
+        businfo & bi = m_container[earliest];
+        *inev = bi.m_pending;
+        bi.m_has_pending = false;
+        m_next_input = (earliest + 1) % buscount;
+    }
+    return result;
 }
 
 /**
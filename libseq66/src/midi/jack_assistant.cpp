@@ -103,8 +103,10 @@
 
 #include <stdio.h>
 #include <string.h>                     /* strdup() <gasp!>                 */
+#include <chrono>                       /* std::chrono::milliseconds        */
 
 #include "midi/jack_assistant.hpp"      /* this seq66::jack_ass class       */
+#include "os/timing.hpp"                /* seq66::microtime()               */
 #include "play/performer.hpp"           /* seq66::performer class           */
 #include "cfg/settings.hpp"             /* "rc" and "user" settings         */
 
@@ -325,6 +327,8 @@ jack_transport_callback (jack_nframes_t /*nframes*/, void * arg)
         jack_position_t pos;
         jack_transport_state_t s = ::jack_transport_query(j->client(), &pos);
         performer & p = j->parent();
+        if (j->cycle_sync())
+            j->post_cycle(s, pos);
 
         /*
          * int psize = ::jack_get_buffer_size(j->client());
@@ -891,7 +895,14 @@ jack_assistant::jack_assistant
     m_ppqn                      (choose_ppqn(ppqn)),
     m_beats_per_measure         (bpmeasure),
     m_beat_width                (beatwidth),
-    m_beats_per_minute          (bpminute)
+    m_beats_per_minute          (bpminute),
+    m_cycle_sync                (false),
+    m_cycle_serial              (0),
+    m_cycle_state               (JackTransportStopped),
+    m_cycle_pos                 (),
+    m_cycle_us                  (0),
+    m_cycle_mutex               (),
+    m_cycle_cond                ()
 {
     /*
      * Do this in the rtmidi constructor.
@@ -1023,6 +1034,7 @@ jack_assistant::init ()
         else
         {
             m_frame_rate = ::jack_get_sample_rate(m_jack_client);
+            m_cycle_sync = rc().jack_cycle_sync();
             get_jack_client_info();
             ::jack_on_shutdown                          /* no return value  */
             (
@@ -1709,7 +1721,14 @@ jack_assistant::output (jack_scratchpad & pad)
     if (m_jack_running)
     {
         pad.js_init_clock = false;              /* no init until a good lock */
-        m_transport_state = ::jack_transport_query(m_jack_client, &jack_pos());
+        bool synced = cycle_sync() &&
+            cycle_snapshot(m_transport_state, jack_pos());
+
+        if (! synced)
+        {
+            m_transport_state =
+                ::jack_transport_query(m_jack_client, &jack_pos());
+        }
 
         /* See Issue #48 above */
 
@@ -1720,7 +1739,9 @@ jack_assistant::output (jack_scratchpad & pad)
         if (transport_rolling_now())
         {
             midipulse midi_ticks;
-            m_frame_current = ::jack_get_current_transport_frame(m_jack_client);
+            m_frame_current = synced ? jack_pos().frame :
+                ::jack_get_current_transport_frame(m_jack_client);
+
             m_frame_last = m_frame_current;
             jack_assistant::set_position(m_frame_current);
             pad.js_dumping = true;              /* "[Start JACK Playback]"  */
@@ -1767,7 +1788,9 @@ jack_assistant::output (jack_scratchpad & pad)
 
         if (pad.js_dumping)
         {
-            m_frame_current = ::jack_get_current_transport_frame(m_jack_client);
+            m_frame_current = synced ? jack_pos().frame :
+                ::jack_get_current_transport_frame(m_jack_client);
+
             if (m_frame_current > m_frame_last)         /* moving ahead?    */
             {
                 /*
@@ -1811,6 +1834,114 @@ jack_assistant::output (jack_scratchpad & pad)
     return m_jack_running;
 }
 
+/**
+ *  Called by jack_transport_callback() at the start of each JACK process
+ *  cycle when cycle synchronization is enabled.  Publishes the transport
+ *  state, position, and start time of the cycle, then wakes the output
+ *  thread.  Nothing
+ *  here blocks: the sequence lock is two atomic increments, and notifying a
+ *  condition variable does not need its mutex.
+ *
+ * \param s
+ *      The transport state obtained by the callback.
+ *
+ * \param pos
+ *      The transport position obtained by the callback.
+ */
+
+void
+jack_assistant::post_cycle
+(
+    jack_transport_state_t s,
+    const jack_position_t & pos
+)
+{
+    m_cycle_serial.fetch_add(1, std::memory_order_acq_rel);    /* odd      */
+    m_cycle_state = s;
+    m_cycle_pos = pos;
+    m_cycle_serial.fetch_add(1, std::memory_order_release);    /* even     */
+    m_cycle_us.store(microtime(), std::memory_order_relaxed);
+    m_cycle_cond.notify_one();
+}
+
+/**
+ *  Copies the transport state and position of the latest cycle, retrying if
+ *  the process callback was writing them at the same time.
+ *
+ * \param [out] s
+ *      Receives the transport state.
+ *
+ * \param [out] pos
+ *      Receives the transport position.
+ *
+ * \return
+ *      Returns true if a consistent snapshot of a cycle was obtained.  If
+ *      false, the caller should query JACK transport directly.
+ */
+
+bool
+jack_assistant::cycle_snapshot
+(
+    jack_transport_state_t & s,
+    jack_position_t & pos
+)
+{
+    for (int attempt = 0; attempt < 4; ++attempt)
+    {
+        unsigned serial = m_cycle_serial.load(std::memory_order_acquire);
+        if (serial > 0 && (serial & 1) == 0)
+        {
+            jack_transport_state_t state = m_cycle_state;
+            jack_position_t position = m_cycle_pos;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_cycle_serial.load(std::memory_order_relaxed) == serial)
+            {
+                s = state;
+                pos = position;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ *  Used by the output thread, in place of its free-running sleep, to wait
+ *  for the start of the next JACK process cycle.  The timeout keeps the
+ *  thread alive if JACK stalls or a wakeup is missed.
+ *
+ * \param [out] lateus
+ *      Set to how long after the start of the latest cycle the thread woke,
+ *      in microseconds.  This is the thread's own lateness, apart from that
+ *      of JACK.  After a timeout it is at least the timeout.  Not set if
+ *      false is returned.
+ *
+ * \return
+ *      Returns true if cycle synchronization is in force, in which case the
+ *      caller should not sleep on its own.
+ */
+
+bool
+jack_assistant::wait_cycle (long & lateus)
+{
+    static const std::chrono::milliseconds s_timeout(100);
+    bool result = cycle_sync();
+    if (result)
+    {
+        unsigned serial = m_cycle_serial.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lk(m_cycle_mutex);
+        (void) m_cycle_cond.wait_for
+        (
+            lk, s_timeout, [this, serial]
+            {
+                return m_cycle_serial.load(std::memory_order_acquire) != serial;
+            }
+        );
+        lateus = microtime() - m_cycle_us.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
 #if defined USE_TIMEBASE_MASTER
 
 /**
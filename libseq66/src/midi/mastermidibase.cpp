@@ -33,6 +33,8 @@
  *  buss classes.
  */
 
+#include <algorithm>                    /* std::min()                       */
+
 #include "cfg/settings.hpp"             /* seq66::rc()                      */
 #include "midi/event.hpp"               /* seq66::event                     */
 #include "midi/mastermidibase.hpp"      /* seq66::mastermidibase            */
@@ -79,7 +81,15 @@ mastermidibase::mastermidibase
     m_vector_sequence   (),             /* stazed feature                   */
     m_filter_by_channel (false),        /* set based on configuration       */
     m_seq               (nullptr),
-    m_mutex             ()
+    m_sounding_notes    (),
+    m_used_channels     (),
+    m_midi_thru         (),
+    m_capturing         (false),
+    m_capture_tick      (0),
+    m_captured          (),
+    m_captured_tempos   (),
+    m_events_played     (0),
+    m_mutex             ("mastermidibus")
 {
     // Empty body now
 }
@@ -249,6 +259,39 @@ mastermidibase::set_beats_per_minute (midibpm bpm)
     automutex locker(m_mutex);
     m_beats_per_minute = bpm;
     api_set_beats_per_minute(bpm);
+    if (m_capturing)
+        m_captured_tempos.push_back(create_tempo_event(m_capture_tick, bpm));
+}
+
+/**
+ *  Starts or stops the capture of played events.  Starting it clears the
+ *  events of any previous capture, and records the current tempo at tick 0.
+ *  The captured events stay available after the capture is stopped.
+ *
+ * \threadsafe
+ *
+ * \param flag
+ *      If true, start capturing; otherwise, go back to sending the events to
+ *      the output busses.
+ */
+
+void
+mastermidibase::capture (bool flag)
+{
+    automutex locker(m_mutex);
+    if (flag && ! m_capturing)
+    {
+        for (auto & evlist : m_captured)
+            evlist.clear();
+
+        m_captured_tempos.clear();
+        m_capture_tick = 0;
+        m_captured_tempos.push_back
+        (
+            create_tempo_event(0, m_beats_per_minute)
+        );
+    }
+    m_capturing = flag;
 }
 
 /**
@@ -263,32 +306,85 @@ void
 mastermidibase::flush ()
 {
     automutex locker(m_mutex);
-    api_flush();
+    if (! m_capturing)
+        api_flush();
 }
 
 /**
- *  Stops all notes on all channels on all busses.  Adapted from Oli Kester's
- *  Kepler34 project.  Whether the buss is active or not is ultimately checked
- *  in the busarray::play() function.  A bit wasteful, but do we really care?
+ *  Stops all sounding notes on all busses.  Adapted from Oli Kester's
+ *  Kepler34 project, which sent a Note Off for every note of every channel
+ *  of every buss (98304 events, enough to choke a DIN port for seconds).
+ *  Now only the notes that play() recorded as still sounding get a Note Off.
+ *  If the "rc" file enables it, each channel used since the last panic
+ *  also gets All Sound Off (CC 120) and All Notes Off (CC 123), which catches
+ *  notes sent to the device by other means.
+ *
+ *  The events are sent round-robin over the busses in small bursts.  If a
+ *  panic rate is configured, each burst is followed by a sleep long enough
+ *  to keep each buss at or under that many messages per second.  The lock
+ *  is released during that sleep, so that the output thread and other
+ *  callers are not stalled for the whole panic.  Whether the buss is active
+ *  or not is ultimately checked in the busarray::play() function.
+ *
+ * \param displaybuss
+ *      A buss to leave alone, such as that of a Launchpad used for MIDI
+ *      control output, whose lights are notes.
  */
 
 void
 mastermidibase::panic (int displaybuss)
 {
-    automutex locker(m_mutex);
+    static const int s_burst = 16;          /* messages per buss per round  */
+    automutex locker(m_mutex);              /* unlocked while sleeping      */
+    bool channelmode = rc().panic_channel_mode();
+    int rate = rc().panic_rate();
+    std::vector<event> pending[c_busscount_max];
+    std::size_t most = 0;
     for (int bus = 0; bus < c_busscount_max; ++bus)
     {
         if (bus == displaybuss)             /* do not clear the Launchpad   */
             continue;
 
+        std::vector<event> & offs = pending[bus];
         for (int channel = 0; channel < c_midichannel_max; ++channel)
         {
-            for (int note = 0; note < c_midibyte_data_max; ++note)
+            std::bitset<c_notes_count> & notes = m_sounding_notes[bus][channel];
+            if (notes.any())
             {
-                event e(0, EVENT_NOTE_OFF, channel, note, 0);
-                m_outbus_array.play(bus, &e, channel);
+                for (int note = 0; note < c_notes_count; ++note)
+                {
+                    if (notes.test(note))
+                        offs.emplace_back(0, EVENT_NOTE_OFF, channel, note, 0);
+                }
+                notes.reset();
+            }
+            if (channelmode && m_used_channels[bus].test(channel))
+            {
+                midibyte cc = EVENT_CONTROL_CHANGE | midibyte(channel);
+                offs.emplace_back(0, cc, midibyte(120), midibyte(0));
+                offs.emplace_back(0, cc, midibyte(123), midibyte(0));
             }
         }
+        m_used_channels[bus].reset();
+        if (offs.size() > most)
+            most = offs.size();
+    }
+    for (std::size_t start = 0; start < most; start += s_burst)
+    {
+        for (int bus = 0; bus < c_busscount_max; ++bus)
+        {
+            std::vector<event> & offs = pending[bus];
+            std::size_t finish = std::min(offs.size(), start + s_burst);
+            for (std::size_t i = start; i < finish; ++i)
+                m_outbus_array.play(bus, &offs[i], offs[i].channel());
+        }
+        api_flush();
+        if (rate > 0 && start + s_burst < most)
+        {
+            locker.unlock();                /* let output thread play       */
+            (void) microsleep(int(s_burst * 1000000L / rate));
+            locker.lock();
+        }
     }
     api_flush();
 }
@@ -307,7 +403,13 @@ void
 mastermidibase::sysex (bussbyte bus, const event * ev)
 {
     automutex locker(m_mutex);
-    m_outbus_array.sysex(bus, ev);
+    if (m_capturing)
+        capture_event(bus, ev, null_channel());
+    else
+    {
+        m_outbus_array.sysex(bus, ev);
+        (void) m_events_played.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 /**
@@ -333,15 +435,103 @@ void
 mastermidibase::play (bussbyte bus, event * e24, midibyte channel)
 {
     automutex locker(m_mutex);
-    m_outbus_array.play(bus, e24, channel);
+    if (m_capturing)
+    {
+        capture_event(bus, e24, channel);
+    }
+    else
+    {
+        track_note(bus, e24, channel);
+        m_outbus_array.play(bus, e24, channel);
+        (void) m_events_played.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 void
 mastermidibase::play_and_flush (bussbyte bus, event * e24, midibyte channel)
 {
     automutex locker(m_mutex);
-    m_outbus_array.play(bus, e24, channel);
-    api_flush();
+    if (m_capturing)
+    {
+        capture_event(bus, e24, channel);
+    }
+    else
+    {
+        track_note(bus, e24, channel);
+        m_outbus_array.play(bus, e24, channel);
+        (void) m_events_played.fetch_add(1, std::memory_order_relaxed);
+        api_flush();
+    }
+}
+
+/**
+ *  Records a copy of an event, stamped with the capture tick and given the
+ *  channel it would have been sent on.  Called under the lock by the play()
+ *  functions when capturing.
+ *
+ * \param bus
+ *      The buss on which the event was to be played.  Events for a bad buss
+ *      are dropped, as busarray::play() would drop them.
+ *
+ * \param e24
+ *      The event to be recorded.
+ *
+ * \param channel
+ *      The channel on which the event was to be played.
+ */
+
+void
+mastermidibase::capture_event
+(
+    bussbyte bus, const event * e24, midibyte channel
+)
+{
+    if (is_good_buss(bus) && int(bus) < c_busscount_max)
+    {
+        event ev(*e24);
+        ev.set_timestamp(m_capture_tick);
+        if (ev.has_channel())
+            ev.set_channel(channel);
+
+        m_captured[bus].push_back(ev);
+    }
+}
+
+/**
+ *  Updates the record of sounding notes and used channels for panic().
+ *  Called under the lock by the play() functions.
+ *
+ * \param bus
+ *      The buss on which the event is to be played.
+ *
+ * \param e24
+ *      The event to be played.
+ *
+ * \param channel
+ *      The channel on which the event is to be played.  It replaces the
+ *      channel nybble of the event status.
+ */
+
+void
+mastermidibase::track_note (bussbyte bus, const event * e24, midibyte channel)
+{
+    midibyte status = e24->get_status();
+    if (is_good_buss(bus) && event::is_channel_msg(status))
+    {
+        int ch = int(channel) % c_midichannel_max;
+        m_used_channels[bus].set(ch);
+        if (e24->is_note())
+        {
+            midibyte d0, d1;
+            e24->get_data(d0, d1);
+            if (d0 < c_midibyte_data_max)
+            {
+                bool on = e24->is_note_on() && d1 > 0;
+                if (on || e24->is_note_off())
+                    m_sounding_notes[bus][ch].set(d0, on);
+            }
+        }
+    }
 }
 
 /**
@@ -569,6 +759,23 @@ mastermidibase::get_input (bussbyte bus) const
     return m_inbus_array.get_input(bus);
 }
 
+/**
+ *  Gets the time elapsed since the arrival of an input event, as measured by
+ *  the input API of the buss on which it arrived.
+ *
+ * \param ev
+ *      Provides the input event, still holding its arrival timestamp.
+ *
+ * \return
+ *      Returns the age in microseconds, or 0 if it is not known.
+ */
+
+long
+mastermidibase::input_age_us (const event & ev)
+{
+    return m_inbus_array.input_age_us(ev.input_bus(), ev.timestamp());
+}
+
 /**
  *  Get the system-buss status for the given (legal) buss number.
  *
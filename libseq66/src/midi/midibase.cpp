@@ -173,7 +173,7 @@ midibase::midibase
     m_lasttick          (0),
     m_io_type           (iotype),
     m_port_type         (porttype),
-    m_mutex             ()
+    m_mutex             ("midibus")
 {
     if (m_port_type != port::manual)
     {
@@ -617,13 +617,18 @@ midibase::stop ()
 }
 
 /**
- *  Generates the MIDI clock, starting at the given tick value.  The number
- *  of ticks needed is calculated.
+ *  Generates the MIDI clock pulses that fall between the last clocked tick
+ *  and the given tick value.  A pulse falls on every multiple of the clock
+ *  interval (PPQN / 24), so the first pulse due is found by rounding the
+ *  tick after m_lasttick up to a multiple of the interval, rather than by
+ *  stepping through every tick.  Each pulse is stamped with its own tick, so
+ *  that an API with timed output (JACK) can place it at its exact position
+ *  within the output cycle, rather than all at the end of the cycle.
  *
  * \threadsafe
  *
  * \param tick
- *      Provides the starting tick.
+ *      Provides the tick value to clock up to, inclusive.
  */
 
 void
@@ -632,14 +637,18 @@ midibase::clock (midipulse tick)
     automutex locker(m_mutex);
     if (clock_enabled())
     {
-        bool done = m_lasttick >= tick;
-        int ct = clock_ticks_from_ppqn(m_ppqn);         /* ppqn / 24        */
-        while (! done)
+        midipulse ct = clock_ticks_from_ppqn(m_ppqn);   /* ppqn / 24        */
+        if (ct > 0 && tick > m_lasttick)
         {
-            ++m_lasttick;
-            done = m_lasttick >= tick;
-            if ((m_lasttick % ct) == 0)                 /* tick time yet?   */
-                api_clock(tick);
+            midipulse next = m_lasttick + 1;
+            if (next < 0)
+                next = 0;
+
+            midipulse pulse = ((next + ct - 1) / ct) * ct;  /* round it up  */
+            for ( ; pulse <= tick; pulse += ct)
+                api_clock(pulse);
+
+            m_lasttick = tick;
         }
         api_flush();                                    /* and send it out  */
     }
@@ -91,6 +91,7 @@
 #include "midi/midifile.hpp"            /* seq66::midifile                  */
 #include "midi/midi_vector.hpp"         /* seq66::midi_vector container     */
 #include "midi/wrkfile.hpp"             /* seq66::wrkfile class             */
+#include "os/timing.hpp"                /* seq66::microtime()               */
 #include "play/performer.hpp"           /* seq66::performer                 */
 #include "play/sequence.hpp"            /* seq66::sequence                  */
 #include "util/filefunctions.hpp"       /* seq66::get_full_path()           */
@@ -281,7 +282,7 @@ midifile::midifile
     bool globalbgs,
     bool verifymode
 ) :
-    m_mutex                     (),
+    m_mutex                     ("midifile"),
     m_verify_mode               (verifymode),
     m_file_size                 (0),
     m_error_message             (),
@@ -2656,6 +2657,50 @@ midifile::prop_item_size (long data_length) const
     return result;
 }
 
+/**
+ *  Writes the bytes collected in m_char_list to the file, and then clears
+ *  the list.  Common code for write(), write_song(), and write_capture().
+ *
+ * \param openerror
+ *      The error message to set if the file cannot be opened.
+ *
+ * \return
+ *      Returns true if the file was opened and written.
+ */
+
+bool
+midifile::write_file (const std::string & openerror)
+{
+    bool result = true;
+    std::ofstream file
+    (
+        m_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc
+    );
+    if (file.is_open())
+    {
+        char file_buffer[c_midi_line_max];          /* enable bufferization */
+        file.rdbuf()->pubsetbuf(file_buffer, sizeof file_buffer);
+        for (auto c : m_char_list)                  /* list of midibytes    */
+        {
+            char kc = char(c);
+            file.write(&kc, 1);
+            if (file.fail())
+            {
+                m_error_message = "Error writing byte.";
+                result = false;
+                break;
+            }
+        }
+        m_char_list.clear();
+    }
+    else
+    {
+        m_error_message = openerror;
+        result = false;
+    }
+    return result;
+}
+
 /**
  *  Write the whole MIDI data and Seq24 information out to the file.
  *  Also see the write_song() function, for exporting to standard MIDI.
@@ -2765,33 +2810,8 @@ midifile::write (performer & p, bool doseqspec)
             m_error_message = "Could not write SeqSpec track.";
     }
     if (result)
-    {
-        std::ofstream file
-        (
-            m_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc
-        );
-        if (file.is_open())
-        {
-            char file_buffer[c_midi_line_max];      /* enable bufferization */
-            file.rdbuf()->pubsetbuf(file_buffer, sizeof file_buffer);
-            for (auto c : m_char_list)              /* list of midibytes    */
-            {
-                char kc = char(c);
-                file.write(&kc, 1);
-                if (file.fail())
-                {
-                    m_error_message = "Error writing byte.";
-                    result = false;
-                }
-            }
-            m_char_list.clear();
-        }
-        else
-        {
-            m_error_message = "Failed to open MIDI file for writing.";
-            result = false;
-        }
-    }
+        result = write_file("Failed to open MIDI file for writing.");
+
     if (result)
         p.unmodify();               /* it worked, tell performer about it   */
 
@@ -2923,32 +2943,123 @@ midifile::write_song (performer & p)
             }
         }
     }
+    if (result)
+        result = write_file("Failed to open MIDI file for export.");
+
+    return result;
+}
+
+/**
+ *  Writes the events captured by performer::render_song() as an SMF 1 file.
+ *  The first track holds the tempo events; then each output buss that got
+ *  any events gets a track of its own, named for the buss.  The channel of
+ *  each event is the channel it was played on, so no SeqSpec data is
+ *  needed.
+ *
+ * \param p
+ *      Provides the performer whose master buss holds the captured events.
+ *
+ * \param endtick
+ *      The tick at which the render ended, used as the length of each track.
+ *
+ * \return
+ *      Returns true if the write operations succeeded.  If false is returned,
+ *      then m_error_message will contain a description of the error.
+ */
+
+bool
+midifile::write_capture (performer & p, midipulse endtick)
+{
+    automutex locker(m_mutex);
+    const mastermidibus * mmb = p.master_bus();
+    bool result = not_nullptr(mmb);
+    std::vector<bussbyte> busses;
+    m_error_message.clear();
     if (result)
     {
-        std::ofstream file
+        for (int bus = 0; bus < c_busscount_max; ++bus)
+        {
+            if (! mmb->captured(bussbyte(bus)).empty())
+                busses.push_back(bussbyte(bus));
+        }
+
+        int numtracks = int(busses.size()) + 1;     /* plus the tempo track */
+        msgprintf
         (
-            m_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc
+            msglevel::status, "Writing render, %d tracks, %d ppqn",
+            numtracks, m_ppqn
         );
-        if (file.is_open())
+        result = write_header(numtracks, 1);
+        if (result)
         {
-            char file_buffer[c_midi_line_max];      /* enable bufferization */
-            file.rdbuf()->pubsetbuf(file_buffer, sizeof file_buffer);
-            for (auto c : m_char_list)
+            int track = 0;
+            write_captured_track
+            (
+                p, mmb->captured_tempos(), "Tempo", track++, endtick
+            );
+            for (auto bus : busses)
             {
-                char kc = char(c);
-                file.write(&kc, 1);
+                std::string name = "Buss " + std::to_string(int(bus));
+                write_captured_track
+                (
+                    p, mmb->captured(bus), name, track++, endtick
+                );
             }
-            m_char_list.clear();
         }
         else
-        {
-            m_error_message = "Failed to open MIDI file for export.";
-            result = false;
-        }
+            m_error_message = "Failed to write header to MIDI file.";
     }
+    else
+        m_error_message = "No master buss to render with.";
+
+    if (result)
+        result = write_file("Failed to open MIDI file for render.");
+
     return result;
 }
 
+/**
+ *  Puts a list of captured events into a scratch sequence, and writes that
+ *  sequence as a plain (no SeqSpec) MIDI track.
+ *
+ * \param p
+ *      The performer, needed by midi_vector_base::fill().
+ *
+ * \param evlist
+ *      The events, already stamped with their render ticks.
+ *
+ * \param name
+ *      The name of the track.
+ *
+ * \param track
+ *      The number of the track.
+ *
+ * \param endtick
+ *      The length of the track.
+ */
+
+void
+midifile::write_captured_track
+(
+    performer & p,
+    const std::vector<event> & evlist,
+    const std::string & name,
+    int track,
+    midipulse endtick
+)
+{
+    sequence s(m_ppqn);
+    s.set_name(name);
+    for (const auto & e : evlist)
+        (void) s.append_event(e);
+
+    (void) s.set_length(endtick, false, false);
+
+    midi_vector lst(s);
+    lst.fill(track, p, false);                      /* sorts the events     */
+    write_track(lst);
+}
+
 /**
  *  Writes out the final proprietary/SeqSpec section, using the new format.
  *
@@ -3440,6 +3551,81 @@ write_midi_file
     return result;
 }
 
+/**
+ *  Renders the song offline, faster than real time, and writes the result
+ *  to a MIDI file.  The time taken by the render itself is reported, as
+ *  a measure of the throughput of the playback engine.
+ *
+ * \param p
+ *      The performer holding the song.  It must not be playing; if it is,
+ *      nothing is rendered and errmsg says to stop playback first.
+ *
+ * \param fn
+ *      The name of the MIDI file to write.
+ *
+ * \param [out] errmsg
+ *      Holds the reason for any failure.
+ *
+ * \return
+ *      Returns true if the song was rendered and written.
+ */
+
+bool
+render_midi_file
+(
+    performer & p,
+    const std::string & fn,
+    std::string & errmsg
+)
+{
+    bool result = false;
+    if (fn.empty())
+    {
+        errmsg = "No file-name to render to";
+    }
+    else if (p.is_running())
+    {
+        errmsg = "Stop playback first; the song cannot render while playing";
+    }
+    else if (is_nullptr(p.master_bus()))
+    {
+        errmsg = "No master buss to render the song with";
+    }
+    else
+    {
+        midipulse endtick = 0;
+        long starttime = microtime();
+        result = p.render_song(endtick);
+        if (result)
+        {
+            long elapsed = microtime() - starttime;
+            double seconds = elapsed > 0 ? elapsed / 1000000.0 : 0.0 ;
+            double rate = seconds > 0.0 ? endtick / seconds : 0.0 ;
+            msgprintf
+            (
+                msglevel::status, "Rendered %ld ticks in %.3f s, %.0f ticks/s",
+                long(endtick), seconds, rate
+            );
+
+            bool glob = usr().global_seq_feature();
+            midifile f(fn, p.ppqn(), glob);
+            result = f.write_capture(p, endtick);
+            if (result)
+            {
+                file_message("Rendered MIDI file", fn);
+            }
+            else
+            {
+                errmsg = f.error_message();
+                file_error("Render failed", fn);
+            }
+        }
+        else
+            errmsg = "Nothing to render; the song has no triggers";
+    }
+    return result;
+}
+
 }           // namespace seq66
 
 /*
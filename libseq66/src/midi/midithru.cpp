@@ -0,0 +1,172 @@
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          midithru.cpp
+ *
+ *  This module defines the table of direct MIDI thru routes.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  See the midithru.hpp module.
+ */
+
+#include "midi/midithru.hpp"            /* seq66::midithru class            */
+#include "play/notemapper.hpp"          /* seq66::notemapper::convert()     */
+#include "util/basic_macros.hpp"        /* not_nullptr() and other macros   */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  Default constructor.  No routes, and an identity note map.
+ */
+
+midithru::midithru () :
+    m_routes    (),
+    m_note_map  (),
+    m_lookup    ()
+{
+    map_notes(nullptr);
+}
+
+/**
+ *  Replaces the routes, builds the lookup table of routes per input buss and
+ *  channel, and fills the note map from the note-mapper.  Must not be called
+ *  while the MIDI engine is active.
+ *
+ * \param r
+ *      The routes, normally from the 'rc' file.
+ *
+ * \param nm
+ *      The note-mapper, if any.  If null, notes are not mapped.
+ */
+
+void
+midithru::setup (const routes & r, const notemapper * nm)
+{
+    m_routes = r;
+    for (auto & bus : m_lookup)
+    {
+        for (auto & channel : bus)
+            channel.clear();
+    }
+    for (int i = 0; i < int(m_routes.size()); ++i)
+    {
+        const route & rt = m_routes[i];
+        if (int(rt.mtr_in_buss) >= c_busscount_max)
+            continue;
+
+        for (int ch = 0; ch < c_midichannel_max; ++ch)
+        {
+            if (rt.mtr_in_channel < 0 || rt.mtr_in_channel == ch)
+                m_lookup[rt.mtr_in_buss][ch].push_back(i);
+        }
+    }
+    map_notes(nm);
+}
+
+/**
+ *  Fills the note map from the note-mapper.  Each entry is stored
+ *  atomically, so this can be called while the MIDI engine is active, as
+ *  when the note-mapper is installed or replaced after the master buss has
+ *  been created.
+ *
+ * \param nm
+ *      The note-mapper, if any.  If null, the map is the identity.
+ */
+
+void
+midithru::map_notes (const notemapper * nm)
+{
+    for (int n = 0; n < c_midibyte_data_max; ++n)
+    {
+        int note = not_nullptr(nm) ? nm->convert(n) : n ;
+        if (note < 0 || note >= c_midibyte_data_max)
+            note = n;
+
+        m_note_map[n].store(midibyte(note), std::memory_order_relaxed);
+    }
+}
+
+/**
+ *  Checks a message against a route and, if it matches, rewrites it for the
+ *  output of the route.  Only channel messages are routed.  Safe to call in
+ *  a realtime callback:  no locking, no allocation.
+ *
+ * \param r
+ *      The route to apply.
+ *
+ * \param inbus
+ *      The buss on which the message arrived.
+ *
+ * \param [inout] msg
+ *      The bytes of the message, a copy to be modified.
+ *
+ * \param len
+ *      The number of bytes in the message.
+ *
+ * \return
+ *      Returns true if the route applies, and the message was rewritten.
+ */
+
+bool
+midithru::apply
+(
+    const route & r, bussbyte inbus, midibyte * msg, int len
+) const
+{
+    bool result = len > 0 && r.mtr_in_buss == inbus;
+    if (result)
+    {
+        midibyte status = msg[0];
+        result = status >= 0x80 && status < 0xF0;      /* channel messages */
+        if (result && r.mtr_in_channel >= 0)
+            result = int(status & 0x0F) == r.mtr_in_channel;
+
+        if (result)
+        {
+            if (r.mtr_out_channel >= 0)
+                msg[0] = (status & 0xF0) | midibyte(r.mtr_out_channel & 0x0F);
+
+            if (r.mtr_map_notes && len > 1 && status < 0xB0)  /* note, AT */
+                msg[1] = m_note_map[msg[1] & 0x7F].load
+                (
+                    std::memory_order_relaxed
+                );
+        }
+    }
+    return result;
+}
+
+}               // namespace seq66
+
+/*
+ * midithru.cpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -97,6 +97,7 @@ mutegroup::mutegroup (mutegroup::number group, int rows, int columns) :
     m_group_state       (false),
     m_group_size        (int(rows * columns)),          /* order important   */
     m_mutegroup_vector  (m_group_size, midibool(false)),
+    m_mutegroup_bits    (),
     m_rows              (rows),
     m_columns           (columns),
     m_swap_coordinates  (usr().swap_coordinates()),
@@ -122,8 +123,18 @@ mutegroup::set (const midibooleans & bits)
 {
     bool result = bits.size() == size_t(m_group_size);
     if (result)
-        m_mutegroup_vector = bits;
+        result = m_group_size <= screenset::c_max_set_size;
 
+    if (result)
+    {
+        m_mutegroup_vector = bits;
+        m_mutegroup_bits.reset();
+        for (int b = 0; b < m_group_size; ++b)
+        {
+            if (bool(bits[b]))
+                m_mutegroup_bits.set(b);
+        }
+    }
     return result;
 }
 
@@ -135,10 +146,8 @@ mutegroup::set (const midibooleans & bits)
 void
 mutegroup::clear ()
 {
-    m_mutegroup_vector.clear();
-    m_mutegroup_vector.reserve(m_group_size);
-    for (auto & mg : m_mutegroup_vector)
-        mg = midibool(false);
+    m_mutegroup_vector.assign(size_t(m_group_size), midibool(false));
+    m_mutegroup_bits.reset();
 }
 
 /**
@@ -152,16 +161,7 @@ mutegroup::clear ()
 bool
 mutegroup::any () const
 {
-    bool result = false;
-    for (auto mg : m_mutegroup_vector)
-    {
-        if (bool(mg))
-        {
-            result = true;
-            break;
-        }
-    }
-    return result;
+    return m_mutegroup_bits.any();
 }
 
 /**
@@ -175,13 +175,7 @@ mutegroup::any () const
 int
 mutegroup::armed_count () const
 {
-    int result = 0;
-    for (auto mg : m_mutegroup_vector)
-    {
-        if (bool(mg))
-            ++result;
-    }
-    return result;
+    return int(m_mutegroup_bits.count());
 }
 
 /**
@@ -258,7 +252,11 @@ void
 mutegroup::armed (int index, bool flag)
 {
     if (index >= 0 && index < m_group_size)
+    {
         m_mutegroup_vector[index] = flag;
+        if (index < screenset::c_max_set_size)
+            m_mutegroup_bits.set(index, flag);
+    }
 }
 
 /**
@@ -387,7 +387,7 @@ mutegroups::mute_group (mutegroup::number gmute)
  */
 
 bool
-mutegroups::apply (mutegroup::number group, midibooleans & bits)
+mutegroups::apply (mutegroup::number group, screenset::armbits & bits)
 {
     auto mgiterator = list().find(clamp_group(group));
     bool result = mgiterator != list().end();
@@ -397,7 +397,7 @@ mutegroups::apply (mutegroup::number group, midibooleans & bits)
         result = mg.any();              /* ignore an inactive mute-group    */
         if (result)
         {
-            bits = mg.get();
+            bits = mg.bits();
             mg.group_state(true);
             m_group_selected = group;
         }
@@ -411,7 +411,7 @@ mutegroups::apply (mutegroup::number group, midibooleans & bits)
  */
 
 bool
-mutegroups::unapply (mutegroup::number group, midibooleans & bits)
+mutegroups::unapply (mutegroup::number group, screenset::armbits & bits)
 {
     bool result = false;
     if (group >= 0)
@@ -424,7 +424,7 @@ mutegroups::unapply (mutegroup::number group, midibooleans & bits)
             result = mg.any();          /* ignore an inactive mute-group    */
             if (result)
             {
-                bits = mg.zeroes();
+                bits.reset();
                 mg.group_state(false);
                 m_group_selected = c_null_mute_group;
             }
@@ -449,7 +449,7 @@ mutegroups::unapply (mutegroup::number group, midibooleans & bits)
  */
 
 bool
-mutegroups::toggle (mutegroup::number group, midibooleans & bits)
+mutegroups::toggle (mutegroup::number group, screenset::armbits & bits)
 {
     auto mgiterator = list().find(clamp_group(group));
     bool result = mgiterator != list().end();
@@ -471,7 +471,11 @@ mutegroups::toggle (mutegroup::number group, midibooleans & bits)
         if (result)
         {
             bool mgnewstate = ! mg.group_state();
-            bits = mgnewstate ? mg.get() : mg.zeroes() ;
+            if (mgnewstate)
+                bits = mg.bits();
+            else
+                bits.reset();
+
             mg.group_state(mgnewstate);
             m_group_selected = mgnewstate ? group : c_null_mute_group ;
         }
@@ -483,10 +487,16 @@ mutegroups::toggle (mutegroup::number group, midibooleans & bits)
  *  Toggles a mute group to the current play-screen in an alternative way.
  *  This alternative is to disarm only the patterns that are marked as active
  *  in the mute group, leaving the other ones set to their current status.
+ *  Turning the group off clears its bits from the armed bits; turning it on
+ *  ORs them in.
  */
 
 bool
-mutegroups::toggle_active (mutegroup::number group, midibooleans & armedbits)
+mutegroups::toggle_active
+(
+    mutegroup::number group,
+    screenset::armbits & armedbits
+)
 {
     auto mgiterator = list().find(clamp_group(group));
     bool result = mgiterator != list().end();
@@ -498,29 +508,16 @@ mutegroups::toggle_active (mutegroup::number group, midibooleans & armedbits)
         }
 
         mutegroup & mg = mgiterator->second;
-        midibooleans mutebits = mg.get();                /* get mutes set    */
+        const screenset::armbits & mutebits = mg.bits();
         bool active = mg.group_state();
-        result = mutebits.size() == armedbits.size();
-        if (result)
-        {
-            auto ait = armedbits.begin();
-            auto mit = mutebits.begin();
-            for ( ; mit != mutebits.end(); ++mit, ++ait)
-            {
-                if (active)
-                {
-                    if (*mit)                           /* on in group?     */
-                        *ait = midibool(false);         /* force it off     */
-                }
-                else
-                {
-                    *ait = *mit || *ait;
-                }
-            }
-            active = ! active;
-            mg.group_state(active);
-            m_group_selected = active ? group : c_null_mute_group ;
-        }
+        if (active)
+            armedbits &= ~mutebits;                     /* force them off   */
+        else
+            armedbits |= mutebits;
+
+        active = ! active;
+        mg.group_state(active);
+        m_group_selected = active ? group : c_null_mute_group ;
     }
     return result;
 }
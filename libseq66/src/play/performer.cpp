@@ -296,6 +296,12 @@ static const int c_delay_stop_ms = 100;
 
 static const int c_long_path_max = 56;
 
+/**
+ *  The maximum number of MIDI input events fetched at once by poll_cycle().
+ */
+
+static const int c_input_batch_size = 32;
+
 /**
  *  Principal constructor.
  */
@@ -352,8 +358,11 @@ performer::performer (int ppqn, int rows, int columns) :
     m_file_ppqn             (0),
     m_bpm                   (usr().midi_beats_per_minute()),
     m_resolution_change     (true),
+    m_rendering             (false),
     m_current_beats         (0),
     m_delta_us              (0),
+    m_input_batch           (c_input_batch_size),
+    m_play_stats            (seq::maximum()),
     m_base_time_ms          (0),
     m_last_time_ms          (0),
     m_beats_per_bar         (usr().midi_beats_per_bar()),
@@ -369,6 +378,8 @@ performer::performer (int ppqn, int rows, int columns) :
     m_start_tick            (0),
     m_tick                  (0),
     m_max_extent            (0),
+    m_extent_cache          (0),
+    m_extent_stale          (true),
     m_jack_pad              (),                 /* data for JACK... & ALSA  */
     m_jack_tick             (0),
     m_usemidiclock          (false),            /* MIDI Clock support       */
@@ -509,6 +520,7 @@ performer::notify_automation_change (automation::slot s)
 void
 performer::notify_set_change (screenset::number setno, change mod)
 {
+    invalidate_extent();
     if (changed(mod))
         modify();
 
@@ -526,6 +538,28 @@ performer::notify_mutes_change (mutegroup::number mutesno, change mod)
         modify();
 }
 
+/**
+ *  The number of notify_deferral objects held by the current thread.
+ */
+
+static thread_local int t_notify_deferrals = 0;
+
+performer::notify_deferral::notify_deferral ()
+{
+    ++t_notify_deferrals;
+}
+
+performer::notify_deferral::~notify_deferral ()
+{
+    --t_notify_deferrals;
+}
+
+bool
+performer::notify_deferral::active ()
+{
+    return t_notify_deferrals > 0;
+}
+
 /**
  *  Called by qseqeventframe.  This function will eventually cause a call to
  *  recreate all the slot buttons in qslivegrid, and when qslivegrid ::
@@ -535,6 +569,11 @@ performer::notify_mutes_change (mutegroup::number mutesno, change mod)
 void
 performer::notify_sequence_change (seq::number seqno, change mod)
 {
+    if (notify_deferral::active())          /* a bulk change will notify    */
+        return;
+
+    invalidate_extent();
+
     bool redo = mod == change::recreate;
     if (mod == change::yes || redo)
         modify();
@@ -557,6 +596,7 @@ performer::notify_ui_change (seq::number seqno, change /*mod*/)
 void
 performer::notify_trigger_change (seq::number seqno, change mod)
 {
+    invalidate_extent();
     for (auto notify : m_notify)
         (void) notify->on_trigger_change(seqno);
 
@@ -584,6 +624,7 @@ void
 performer::notify_resolution_change (int ppqn, midibpm bpm, change mod)
 {
     m_resolution_change = true;
+    invalidate_extent();
     for (auto notify : m_notify)
         (void) notify->on_resolution_change(ppqn, bpm);
 
@@ -1192,6 +1233,7 @@ performer::install_sequence (sequence * s, seq::number & seqno, bool fileload)
     if (result)
     {
         s->set_parent(this);                    /* also sets a lot of stuff */
+        invalidate_extent();
         if (rc().is_setsmode_clear())           /* i.e. normal or auto-arm  */
         {
             /*
@@ -1826,7 +1868,10 @@ performer::ppqn () const
  *  Goes through all sets and sequences, updating the PPQN of the events and
  *  triggers.  It also, via notify_resolution_change(), sets the modify flag.
  *
- *  Currently operates only on the current screenset.
+ *  The sequences are independent, so they are rescaled on several threads.
+ *  Each rescale holds a notify_deferral, so its change notifications are
+ *  dropped, and replaced by the single notify_resolution_change() at the
+ *  end.
  */
 
 bool
@@ -1835,15 +1880,13 @@ performer::change_ppqn (int p)
     bool result = set_ppqn(p);                  /* performer & master bus   */
     if (result)
     {
-        mapper().exec_set_function
+        mapper().exec_parallel_function
         (
             [p] (seq::pointer sp, seq::number /*sn*/)
             {
-                bool result = bool(sp);
-                if (result)
-                    sp->change_ppqn(p);
-
-                return result;
+                notify_deferral nd;             /* this thread only         */
+                (void) sp->change_ppqn(p);      /* locks its own mutex      */
+                return true;
             }
         );
         if (result)
@@ -1988,6 +2031,7 @@ void
 performer::inner_stop (bool midiclock)
 {
     is_running(false);
+    settle_mutes();                     /* no more frames to apply them     */
     reset_sequences();                  /* resets, and flushes the buss     */
     m_usemidiclock = midiclock;
     send_onoff_event(midicontrolout::uiaction::stop, true);
@@ -2483,6 +2527,7 @@ performer::clear_song ()
         set_have_redo(false);
         m_redo_vect.clear();
         mapper().reset();               /* clears and recreates empty set   */
+        invalidate_extent();
         m_is_busy = false;
         unmodify();                     /* new, we start afresh             */
         set_needs_update();             /* tell all GUIs to refresh. BUG!   */
@@ -2642,6 +2687,7 @@ performer::create_master_bus ()
         {
             mastermidibus * mmb = m_master_bus.get();
             mmb->filter_by_channel(m_filter_by_channel);
+            mmb->midi_thru(rc().thru_routes(), m_note_mapper.get());
             mmb->set_port_statuses(m_clocks, m_inputs);
             midi_control_out().set_master_bus(mmb);
             result = true;
@@ -2859,9 +2905,25 @@ performer::announce_sequence (seq::pointer s, seq::number sn)
     return true;
 }
 
+/**
+ *  Announces the status of a pattern to the MIDI control output.  This is
+ *  not done by the worker threads of a bulk operation, which would then send
+ *  to the output buss from several threads at once; the operation announces
+ *  afterward, if needed.
+ *
+ * \param seqno
+ *      The number of the pattern.
+ *
+ * \return
+ *      Returns true if the pattern exists and was announced.
+ */
+
 bool
 performer::announce_pattern (seq::number seqno)
 {
+    if (notify_deferral::active())
+        return false;
+
     seq::pointer s = get_sequence(seqno);
     bool result = bool(s);
     if (result)
@@ -3733,6 +3795,7 @@ performer::output_func ()
         long current;                           /* current time             */
         long elapsed_us, delta_us;              /* current - last           */
         long last = microtime();                /* beginning time           */
+        unsigned long lastevents = m_master_bus->events_played();
         m_resolution_change = false;            /* BPM/PPQN                 */
         while (is_running())
         {
@@ -3853,15 +3916,34 @@ performer::output_func ()
             elapsed_us = current - last;
             delta_us = c_thread_trigger_width_us - elapsed_us;
 
+            unsigned long events = m_master_bus->events_played();
+            m_play_stats.add(playstats::measure::frame, elapsed_us);
+            m_play_stats.add
+            (
+                playstats::measure::events, long(events - lastevents)
+            );
+            lastevents = events;
+
             double next_clock_delta = dct - 1;
             double next_clock_delta_us = next_clock_delta * pus;
             if (next_clock_delta_us < (c_thread_trigger_width_us * 2.0))
                 delta_us = long(next_clock_delta_us);
 
-            if (delta_us > 0)
+            long cyclelate_us = 0;
+            if (jackrunning && jack_wait_cycle(cyclelate_us))
+            {
+                m_delta_us = 0;                     /* paced by JACK cycle  */
+                m_play_stats.add(playstats::measure::lateness, cyclelate_us);
+            }
+            else if (delta_us > 0)
             {
                 (void) microsleep(int(delta_us));           /* timing.hpp   */
                 m_delta_us = 0;
+                m_play_stats.add
+                (
+                    playstats::measure::lateness,
+                    microtime() - current - delta_us    /* oversleep        */
+                );
             }
             else
             {
@@ -3877,6 +3959,7 @@ performer::output_func ()
                 }
 #endif
                 m_delta_us = delta_us;
+                m_play_stats.add(playstats::measure::lateness, -delta_us);
             }
             if (pad().js_jack_stopped)
                 inner_stop();
@@ -3959,7 +4042,9 @@ performer::input_func ()
 }
 
 /**
- *  A helper function for input_func().
+ *  A helper function for input_func().  The input events are fetched in
+ *  batches, in order of arrival across all of the input busses, into the
+ *  m_input_batch buffer.
  */
 
 bool
@@ -3968,83 +4053,153 @@ performer::poll_cycle ()
     bool result = ! done();
     if (result && m_master_bus->poll_for_midi() > 0)
     {
+        event * evs = m_input_batch.data();
         do
         {
-            if (done())
+            int count = m_master_bus->get_midi_events(evs, c_input_batch_size);
+            for (int i = 0; i < count; ++i)
             {
-                result = false;
-                break;                              /* spurious exit events */
-            }
-
-            event ev;
-            if (m_master_bus->get_midi_event(&ev))
-            {
-                if (ev.below_sysex())                       /* below 0xF0   */
-                {
-                    if (m_master_bus->is_dumping())         /* see banner   */
-                    {
-                        if (midi_control_event(ev, true))   /* quick check  */
-                        {
-                            // No code at this time
-                        }
-                        else
-                        {
-                            ev.set_timestamp(get_tick());
-                            if (m_filter_by_channel)
-                                m_master_bus->dump_midi_input(ev);
-                            else
-                                m_master_bus->get_sequence()->stream_event(ev);
-                        }
-                    }
-                    else
-                        (void) midi_control_event(ev);
-                }
-                else if (ev.is_midi_start())
-                {
-                    midi_start();
-                }
-                else if (ev.is_midi_continue())
-                {
-                    midi_continue();
-                }
-                else if (ev.is_midi_stop())
-                {
-                    midi_stop();
-                }
-                else if (ev.is_midi_clock())
+                if (done())
                 {
-                    midi_clock();
+                    result = false;
+                    break;                          /* spurious exit events */
                 }
-                else if (ev.is_midi_song_pos())
+                if (! dispatch_input_event(evs[i]))
                 {
-                    midi_song_pos(ev);
+                    result = false;
+                    break;
                 }
-                else if (ev.is_tempo())             /* added for issue #76  */
-                {
-                    /*
-                     * Should we do this only if JACK transport is not
-                     * enabled?
-                     */
+            }
+            if (count == 0 || ! result)
+                break;
+        } while (m_master_bus->is_more_input());
+    }
+    if (result)
+        m_midi_control_out.send_feedback();     /* one batch of LED changes */
 
-                    if (is_jack_master() || ! is_jack_running())
-                        (void) set_beats_per_minute(ev.tempo());
-                }
-                else if (ev.is_sysex())
-                {
-                    midi_sysex(ev);
-                }
-#if defined USE_ACTIVE_SENSE_AND_RESET
-                else if (ev.is_sense_reset())
-                {
-                    return false;                   /* see note in banner   */
-                }
-#endif
+    return result;
+}
+
+/**
+ *  Calculates the tick at which an incoming event is to be recorded.  The
+ *  current tick is moved back by the time the event waited in the input
+ *  queue (as reported by the API of its buss, which is 0 if the API does not
+ *  timestamp input) plus the configured input latency of the buss.  The
+ *  conversion uses the current tempo, which is close enough for the few
+ *  milliseconds involved.  A negative latency offset moves the tick forward.
+ *
+ * \param ev
+ *      The input event, still holding the timestamp set by the input API.
+ *
+ * \return
+ *      Returns the compensated tick, never less than 0.
+ */
+
+midipulse
+performer::input_tick (const event & ev)
+{
+    midipulse result = get_tick();
+    if (is_running())
+    {
+        long us = m_master_bus->input_age_us(ev) +
+            rc().input_latency_us(ev.input_bus());
+
+        if (us != 0)
+        {
+            unsigned long absus = us > 0 ? us : -us ;
+            midipulse delta = midipulse
+            (
+                delta_time_us_to_ticks(absus, get_beats_per_minute(), ppqn())
+            );
+            if (us < 0)
+                result += delta;
+            else if (delta < result)
+                result -= delta;
+            else
+                result = 0;
+        }
+    }
+    return result;
+}
+
+/**
+ *  Handles one MIDI input event for poll_cycle().  See the banner of
+ *  input_func().
+ *
+ * \param ev
+ *      The input event.  Its timestamp is replaced if it is recorded.
+ *
+ * \return
+ *      Returns false if input polling should stop.
+ */
+
+bool
+performer::dispatch_input_event (event & ev)
+{
+    bool result = true;
+    if (ev.below_sysex())                                     /* below 0xF0   */
+    {
+        if (m_master_bus->is_dumping())                       /* see banner   */
+        {
+            if (midi_control_event(ev, true))                 /* quick check  */
+            {
+                // No code at this time
+            }
+            else
+            {
+                ev.set_timestamp(input_tick(ev));
+                if (m_filter_by_channel)
+                    m_master_bus->dump_midi_input(ev);
                 else
-                {
-                    /* ignore the event */
-                }
+                    m_master_bus->get_sequence()->stream_event(ev);
             }
-        } while (m_master_bus->is_more_input());
+        }
+        else
+            (void) midi_control_event(ev);
+    }
+    else if (ev.is_midi_start())
+    {
+        midi_start();
+    }
+    else if (ev.is_midi_continue())
+    {
+        midi_continue();
+    }
+    else if (ev.is_midi_stop())
+    {
+        midi_stop();
+    }
+    else if (ev.is_midi_clock())
+    {
+        midi_clock();
+    }
+    else if (ev.is_midi_song_pos())
+    {
+        midi_song_pos(ev);
+    }
+    else if (ev.is_tempo())                           /* added for issue #76  */
+    {
+        /*
+         * Should we do this only if JACK transport is not
+         * enabled?
+         */
+
+        if (is_jack_master() || ! is_jack_running())
+            (void) set_beats_per_minute(ev.tempo());
+    }
+    else if (ev.is_sysex())
+    {
+        midi_sysex(ev);
+    }
+#if defined USE_ACTIVE_SENSE_AND_RESET
+    else if (ev.is_sense_reset())
+    {
+        result = false;                               /* see note in banner   */
+    }
+#endif
+    else
+    {
+        /* ignore the event */
     }
     return result;
 }
@@ -4578,6 +4733,8 @@ performer::play (midipulse tick)
         }
 
         set_tick(tick);
+        (void) mapper().apply_pending_bits();           /* mute-group bits  */
+
         for (auto seqi : play_set().seq_container())
         {
             if (seqi)
@@ -4589,12 +4746,71 @@ performer::play (midipulse tick)
     }
 }
 
+/**
+ *  Renders the song offline.  The real playback engine, play() and
+ *  sequence::play_queue(), is driven one pulse at a time against a simulated
+ *  clock, as fast as the CPU allows, while the master buss captures the
+ *  events (and tempo changes) instead of sending them.  Song mode is used for
+ *  the render, and the previous mode, tempo, and modification status are
+ *  restored afterward.  The captured events are left in the master buss;
+ *  see mastermidibase::captured() and midifile::write_capture().
+ *
+ *  Playback must be stopped.  Note-offs for the notes still sounding at the
+ *  end of the song are captured at the end tick.
+ *
+ * \param [out] endtick
+ *      Set to the end of the song, the last tick of the last trigger.
+ *
+ * \return
+ *      Returns true if there was a song to render.
+ */
+
+bool
+performer::render_song (midipulse & endtick)
+{
+    bool result = ! is_running() && m_master_bus;
+    if (result)
+    {
+        endtick = get_max_trigger();
+        result = endtick > 0;
+    }
+    if (result)
+    {
+        sequence::playback oldmode = song_start_mode();
+        midibpm oldbpm = get_beats_per_minute();
+        bool wasmodified = modified();
+        m_rendering = true;
+        song_mode(true);
+        m_master_bus->capture(true);
+        off_sequences();                                /* mute for song    */
+        reset_sequences();                              /* zero the markers */
+        set_tick(0);
+        set_last_ticks(0);
+        for (midipulse tick = 0; tick < endtick; ++tick)
+        {
+            m_master_bus->capture_tick(tick);
+            play(tick);
+        }
+        m_master_bus->capture_tick(endtick);
+        reset_sequences();                              /* final note-offs  */
+        m_master_bus->capture(false);
+        (void) set_beats_per_minute(oldbpm);
+        song_start_mode(oldmode);
+        set_tick(0);
+        m_rendering = false;
+        if (! wasmodified)
+            unmodify();
+    }
+    return result;
+}
+
 void
 performer::play_all_sets (midipulse tick)
 {
     if (tick > get_tick() || tick == 0)                 /* avoid replays    */
     {
         set_tick(tick);
+        (void) mapper().apply_pending_bits();           /* mute-group bits  */
         sequence::playback songmode = song_start_mode();
         mapper().play_all_sets(tick, songmode, resume_note_ons());
         m_master_bus->flush();                          /* flush MIDI buss  */
@@ -4953,19 +5169,28 @@ performer::box_move_triggers (midipulse offset)
  * -------------------------------------------------------------------------
  */
 
+/**
+ *  Gets the full extent of the song:  the largest of the pattern lengths,
+ *  the last event timestamps, and the trigger ends.  This function is
+ *  polled often (auto-stop in play(), duration strings, sizing of the song
+ *  editor), so the result of the walk through all the sets is cached until
+ *  invalidate_extent() is called.
+ *
+ *  The stale flag is cleared before the walk, so that an edit made during
+ *  the walk (e.g. by recording in the input thread) will force another
+ *  walk on the next call.
+ *
+ * \return
+ *      Returns the cached or newly calculated extent, in pulses.
+ */
+
 midipulse
 performer::get_max_extent () const
 {
-    midipulse timelen = get_max_timestamp();
-    midipulse triglen = get_max_trigger();
-    midipulse result = mapper().max_extent();
-    if (triglen > result)
-        result = triglen;
-
-    if (timelen > result)
-        result = timelen;
+    if (m_extent_stale.exchange(false))
+        m_extent_cache = mapper().max_extent();
 
-    return result;
+    return m_extent_cache;
 }
 
 std::string
@@ -5550,6 +5775,7 @@ performer::pop_trigger_undo ()
             if (s)
                 s->pop_trigger_undo();
         }
+        invalidate_extent();
         set_have_undo(! m_undo_vect.empty());
         set_have_redo(! m_redo_vect.empty());
     }
@@ -5578,6 +5804,7 @@ performer::pop_trigger_redo ()
             if (s)
                 s->pop_trigger_redo();
         }
+        invalidate_extent();
         set_have_undo(! m_undo_vect.empty());
         set_have_redo(! m_redo_vect.empty());
     }
@@ -6679,8 +6906,10 @@ performer::apply_mutes (mutegroup::number group)
     mutegroup::number oldgroup = mutes().group_selected();
     bool result = mapper().apply_mutes(group);
     if (result)
+    {
+        settle_mutes();
         send_mutes_events(group, oldgroup);
-
+    }
     return result;
 }
 
@@ -6689,8 +6918,10 @@ performer::unapply_mutes (mutegroup::number group)
 {
     bool result = mapper().unapply_mutes(group);
     if (result)
+    {
+        settle_mutes();
         midi_control_out().send_mutes_event(group, midicontrolout::action_off);
-
+    }
     return result;
 }
 
@@ -6702,6 +6933,7 @@ performer::toggle_mutes (mutegroup::number group)
     if (result)
     {
         mutegroup::number newgroup = mutes().group_selected();
+        settle_mutes();
         send_mutes_events(newgroup, oldgroup);
     }
     return result;
@@ -6715,11 +6947,25 @@ performer::toggle_active_mutes (mutegroup::number group)
     if (result)
     {
         mutegroup::number newgroup = mutes().group_selected();
+        settle_mutes();
         send_mutes_events(newgroup, oldgroup);
     }
     return result;
 }
 
+/**
+ *  The setmapper holds the armed statuses from a mute-group operation until
+ *  the start of the next output frame (see play()).  When not playing, there
+ *  is no next frame, so they are applied right away.
+ */
+
+void
+performer::settle_mutes ()
+{
+    if (! is_running())
+        (void) mapper().apply_pending_bits();
+}
+
 /**
  *  Provides a solution to "SM: pattern state isn't recalled with session
  *  (#27).  It actually applies to normal operation as well.
@@ -7832,23 +8078,39 @@ performer::open_note_mapper (const std::string & notefile)
         }
         else
         {
-            if (file_readable(notefile))
-            {
-                notemapfile nmf(*m_note_mapper, notefile, rc());
-                result = nmf.parse();
-                if (! result)
-                    set_error_message(nmf.get_error_message());
-            }
-            else
-            {
-                std::string msg = "Cannot read: " + notefile;
-                set_error_message(msg);
-            }
+            std::string errmsg;
+            result = read_notemapper(*m_note_mapper, notefile, errmsg);
+            if (! result)
+                set_error_message(errmsg);
         }
     }
+    if (m_master_bus)
+        m_master_bus->midi_thru_notes(m_note_mapper.get());
+
     return result;
 }
 
+/**
+ *  Replaces the note-mapper with one that has already been read.  Used at
+ *  startup, where the note-map file is read while the performer is being
+ *  created.  If the master buss already exists, the note map of its MIDI
+ *  thru routes is refreshed, so the order of the two does not matter.
+ *
+ * \param nm
+ *      The note-mapper to take over.  If null, nothing is done.
+ */
+
+void
+performer::note_mapper (std::unique_ptr<notemapper> nm)
+{
+    if (nm)
+    {
+        m_note_mapper = std::move(nm);
+        if (m_master_bus)
+            m_master_bus->midi_thru_notes(m_note_mapper.get());
+    }
+}
+
 bool
 performer::save_note_mapper (const std::string & notefile)
 {
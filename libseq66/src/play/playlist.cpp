@@ -252,13 +252,18 @@ playlist::open_select_song_by_midi (int ctrl, bool opensong)
  *      does not make configuration settings.  Setting this option to true can
  *      slow startup way down if there are a lot of big files in the playlist.
  *
+ * \param lazy
+ *      If true, only the current play-list is checked.  The others are
+ *      checked by open_current_song() when they are first selected, which
+ *      keeps the startup time low for a large playlist file.
+ *
  * \return
  *      Returns true if all of the MIDI files are verifiable.  A blank
  *      filename (empty playlist) results in a false return value.
  */
 
 bool
-playlist::verify (bool strong)
+playlist::verify (bool strong, bool lazy)
 {
     bool result = ! m_play_lists.empty();
     if (result)
@@ -277,51 +282,19 @@ playlist::verify (bool strong)
     }
     if (result)
     {
-        for (const auto & plpair : m_play_lists)
+        if (lazy)
+        {
+            if (m_current_list != m_play_lists.end())
+                result = verify_list(m_current_list->second, strong);
+        }
+        else
         {
-            const song_list & sl = plpair.second.ls_song_list;
-            for (const auto & sci : sl)
+            for (auto & plpair : m_play_lists)
             {
-                const song_spec_t & s = sci.second;
-                std::string fname = song_filepath(s);
-                if (fname.empty())
-                {
-                    result = false;
-                    break;
-                }
-                if (file_exists(fname))
-                {
-                    if (strong)
-                    {
-                        /*
-                         * The file is parsed.  If the result is false, then
-                         * the play-list mode ends up false.  Let the caller
-                         * do the reporting on errors.
-                         */
-
-                        result = open_song(fname, true);
-                        if (result)
-                        {
-                            if (rc().verbose())
-                                file_message("Verified", fname);
-                        }
-                        else
-                        {
-                            set_file_error_message("song '%s' missing", fname);
-                            break;
-                        }
-                    }
-                }
-                else
-                {
-                    std::string fmt = plpair.second.ls_list_name;
-                    fmt += ": song '%s' missing; check relative directories.";
-                    result = set_file_error_message(fmt, fname);
+                result = verify_list(plpair.second, strong);
+                if (! result)
                     break;
-                }
             }
-            if (! result)
-                break;
         }
     }
     else
@@ -334,6 +307,70 @@ playlist::verify (bool strong)
     return result;
 }
 
+/**
+ *  Makes sure that the MIDI files of one play-list exist.  Marks the list
+ *  as verified, even if a file is missing, so that the check is not
+ *  repeated every time a song in the list is opened.
+ *
+ * \param plist
+ *      The play-list to check.
+ *
+ * \param strong
+ *      If true, also make sure the MIDI files open without error as well.
+ *
+ * \return
+ *      Returns true if all of the MIDI files in the list are verifiable.
+ */
+
+bool
+playlist::verify_list (play_list_t & plist, bool strong)
+{
+    bool result = true;
+    const song_list & sl = plist.ls_song_list;
+    for (const auto & sci : sl)
+    {
+        const song_spec_t & s = sci.second;
+        std::string fname = song_filepath(s);
+        if (fname.empty())
+        {
+            result = false;
+            break;
+        }
+        if (file_exists(fname))
+        {
+            if (strong)
+            {
+                /*
+                 * The file is parsed.  If the result is false, then
+                 * the play-list mode ends up false.  Let the caller
+                 * do the reporting on errors.
+                 */
+
+                result = open_song(fname, true);
+                if (result)
+                {
+                    if (rc().verbose())
+                        file_message("Verified", fname);
+                }
+                else
+                {
+                    set_file_error_message("song '%s' missing", fname);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            std::string fmt = plist.ls_list_name;
+            fmt += ": song '%s' missing; check relative directories.";
+            result = set_file_error_message(fmt, fname);
+            break;
+        }
+    }
+    plist.ls_verified = true;
+    return result;
+}
+
 /**
  *  This function copies all of the MIDI files in all of the play-lists to a
  *  new root directory.
@@ -452,6 +489,9 @@ playlist::open_current_song ()
             if (! result)
                 return true;            /* no songs to open */
 
+            if (! plist.ls_verified)
+                (void) verify_list(plist, false);   /* reports missing song */
+
             if (result)
                 result = m_current_song != plist.ls_song_list.end();
 
@@ -875,6 +915,7 @@ playlist::add_list
     plist.ls_list_name = name;
     plist.ls_file_directory = directory;
     plist.ls_song_count = 0;            /* no songs to start in new list    */
+    plist.ls_verified = false;          /* nothing to check yet             */
 
     /*
      * Song list is empty at first, created by the playlist default constructor.
@@ -904,6 +945,7 @@ playlist::modify_list
         plist.ls_midi_number = midinumber;  /* MIDI control number to use   */
         plist.ls_list_name = name;
         plist.ls_file_directory = directory;
+        plist.ls_verified = false;          /* song paths may have changed  */
     }
     return result;
 }
@@ -0,0 +1,319 @@
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          playstats.cpp
+ *
+ *  This module defines the timing statistics of the output thread.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  Adding a sample is a handful of relaxed atomic operations, so the
+ *  statistics are always kept.
+ */
+
+#include <algorithm>                    /* std::sort()                      */
+#include <chrono>                       /* std::chrono::steady_clock        */
+#include <cstdio>                       /* std::snprintf()                  */
+#include <limits>                       /* std::numeric_limits<>            */
+
+#include "play/playstats.hpp"           /* seq66::playstats, histogram      */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  Raises an atomic maximum to a value, if larger.  A compare-exchange
+ *  loop, so that two threads adding at once cannot lower the maximum.
+ */
+
+static void
+raise_maximum (std::atomic<long> & maximum, long value)
+{
+    long current = maximum.load(std::memory_order_relaxed);
+    while
+    (
+        value > current && ! maximum.compare_exchange_weak
+        (
+            current, value, std::memory_order_relaxed
+        )
+    )
+    {
+        /* current has been reloaded; try again */
+    }
+}
+
+/*
+ * class histogram
+ */
+
+histogram::histogram () :
+    m_buckets   (),
+    m_samples   (0),
+    m_sum       (0),
+    m_max       (0)
+{
+    clear();
+}
+
+/**
+ *  Adds a sample.  Safe to call from several threads at once.
+ */
+
+void
+histogram::add (long value)
+{
+    int b = 0;
+    if (value > 0)
+    {
+        unsigned long v = (unsigned long)(value);
+        while (v != 0 && b < c_bucket_count - 1)
+        {
+            v >>= 1;
+            ++b;
+        }
+    }
+    (void) m_buckets[b].fetch_add(1, std::memory_order_relaxed);
+    (void) m_sum.fetch_add(value, std::memory_order_relaxed);
+    (void) m_samples.fetch_add(1, std::memory_order_relaxed);
+    raise_maximum(m_max, value);
+}
+
+void
+histogram::clear ()
+{
+    for (auto & b : m_buckets)
+        b.store(0, std::memory_order_relaxed);
+
+    m_samples.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(std::numeric_limits<long>::min(), std::memory_order_relaxed);
+}
+
+double
+histogram::mean () const
+{
+    unsigned long n = samples();
+    return n > 0 ?
+        double(m_sum.load(std::memory_order_relaxed)) / double(n) : 0.0 ;
+}
+
+/**
+ *  The largest value counted by a bucket.  The last bucket has no limit,
+ *  and returns the maximum long value.
+ */
+
+long
+histogram::bucket_limit (int b)
+{
+    if (b <= 0)
+        return 0;
+    else if (b >= c_bucket_count - 1)
+        return std::numeric_limits<long>::max();
+    else
+        return (1L << b) - 1;
+}
+
+/**
+ *  Finds an upper bound on a percentile, which is the limit of the bucket
+ *  in which it falls, or the maximum if it falls in the last bucket.
+ *
+ * \param p
+ *      The percentile, from 0.0 to 100.0.
+ */
+
+long
+histogram::percentile (double p) const
+{
+    unsigned long n = samples();
+    if (n == 0)
+        return 0;
+
+    unsigned long target = (unsigned long)(double(n) * p / 100.0 + 0.5);
+    unsigned long count = 0;
+    for (int b = 0; b < c_bucket_count - 1; ++b)
+    {
+        count += bucket(b);
+        if (count >= target)
+            return std::min(bucket_limit(b), maximum());
+    }
+    return maximum();
+}
+
+/**
+ *  A one-line summary: samples, mean, percentiles, and maximum.
+ */
+
+std::string
+histogram::summary (const std::string & units) const
+{
+    char temp[160];
+    const char * u = units.c_str();
+    (void) snprintf
+    (
+        temp, sizeof temp,
+        "n %lu, mean %.1f %s, p50 <= %ld, p99 <= %ld, max %ld %s",
+        samples(), mean(), u, percentile(50.0), percentile(99.0),
+        maximum(), u
+    );
+    return std::string(temp);
+}
+
+/*
+ * class playstats
+ */
+
+playstats::playstats (int seqcount) :
+    m_histograms    (),
+    m_seq_costs     (size_t(seqcount > 0 ? seqcount : 0))
+{
+    clear();
+}
+
+long
+playstats::now_ns ()
+{
+    using namespace std::chrono;
+    auto t = steady_clock::now().time_since_epoch();
+    return long(duration_cast<nanoseconds>(t).count());
+}
+
+/**
+ *  Adds the time one pattern took to play in one frame.  Safe to call from
+ *  several threads at once.
+ *
+ * \param seqno
+ *      The pattern number.  Out-of-range numbers are ignored.
+ *
+ * \param ns
+ *      The time spent in sequence::play_queue(), in nanoseconds.
+ */
+
+void
+playstats::add_sequence_cost (int seqno, long ns)
+{
+    if (seqno >= 0 && seqno < int(m_seq_costs.size()))
+    {
+        seqcost & sc = m_seq_costs[size_t(seqno)];
+        (void) sc.sc_calls.fetch_add(1, std::memory_order_relaxed);
+        (void) sc.sc_total_ns.fetch_add(ns, std::memory_order_relaxed);
+        raise_maximum(sc.sc_max_ns, ns);
+    }
+}
+
+void
+playstats::clear ()
+{
+    for (auto & h : m_histograms)
+        h.clear();
+
+    for (auto & sc : m_seq_costs)
+    {
+        sc.sc_calls.store(0, std::memory_order_relaxed);
+        sc.sc_total_ns.store(0, std::memory_order_relaxed);
+        sc.sc_max_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ *  Makes a text report of the histograms and of the patterns that have cost
+ *  the most time in total.
+ *
+ * \param topcount
+ *      The number of patterns to list.
+ *
+ * \return
+ *      Returns lines of text, without a trailing newline.
+ */
+
+std::string
+playstats::report (int topcount) const
+{
+    std::string result = "Output thread, " + std::to_string(frames()) +
+        " frames:";
+
+    result += "\n  lateness: " + get(measure::lateness).summary("us");
+    result += "\n  frame:    " + get(measure::frame).summary("us");
+    result += "\n  events:   " + get(measure::events).summary("");
+    result += "\n  lockwait: " + get(measure::lockwait).summary("ns");
+
+    struct costline
+    {
+        int cl_seqno;
+        long long cl_total_ns;
+        unsigned long cl_calls;
+        long cl_max_ns;
+    };
+    std::vector<costline> costs;
+    for (int s = 0; s < int(m_seq_costs.size()); ++s)
+    {
+        const seqcost & sc = m_seq_costs[size_t(s)];
+        unsigned long calls = sc.sc_calls.load(std::memory_order_relaxed);
+        if (calls > 0)
+        {
+            costline cl;
+            cl.cl_seqno = s;
+            cl.cl_total_ns = sc.sc_total_ns.load(std::memory_order_relaxed);
+            cl.cl_calls = calls;
+            cl.cl_max_ns = sc.sc_max_ns.load(std::memory_order_relaxed);
+            costs.push_back(cl);
+        }
+    }
+    std::sort
+    (
+        costs.begin(), costs.end(),
+        [] (const costline & a, const costline & b)
+        {
+            return a.cl_total_ns > b.cl_total_ns;
+        }
+    );
+    if (int(costs.size()) > topcount)
+        costs.resize(size_t(topcount));
+
+    for (const auto & cl : costs)
+    {
+        char temp[128];
+        (void) snprintf
+        (
+            temp, sizeof temp,
+            "\n  pattern %4d: total %lld us, mean %.1f us, max %.1f us",
+            cl.cl_seqno, cl.cl_total_ns / 1000,
+            double(cl.cl_total_ns) / double(cl.cl_calls) / 1000.0,
+            double(cl.cl_max_ns) / 1000.0
+        );
+        result += temp;
+    }
+    return result;
+}
+
+}           // namespace seq66
+
+/*
+ * playstats.cpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -663,6 +663,11 @@ screenset::max_timestamp () const
     return result;
 }
 
+/**
+ *  Gets the largest extent (length, last event, or last trigger) of the
+ *  active patterns in this set.  See sequence::get_max_extent().
+ */
+
 midipulse
 screenset::max_extent () const
 {
@@ -671,7 +676,7 @@ screenset::max_extent () const
     {
         if (s.active())
         {
-            midipulse t = s.loop()->get_length();
+            midipulse t = s.loop()->get_max_extent();
             if (t > result)
                 result = t;
         }
@@ -1352,6 +1357,37 @@ screenset::apply_bits (const midibooleans & bits)
     return result;
 }
 
+/**
+ *  Applies a set of armed bits as track-muting values.  Every existing
+ *  sequence of the set is muted or unmuted, as in the midibooleans version,
+ *  because the song-mute and armed flags of a sequence can differ.
+ *
+ * \param bits
+ *      Provides the armed statuses, one bit per slot of the set.
+ *
+ * \return
+ *      Returns true if the set has slots.
+ */
+
+bool
+screenset::apply_bits (const armbits & bits)
+{
+    bool result = count() > 0;
+    if (result)
+    {
+        int bit = 0;
+        int bitcount = std::min(m_set_size, c_max_set_size);
+        seq::number seqend = offset() + bitcount;
+        for (seq::number seqno = offset(); seqno != seqend; ++seqno, ++bit)
+        {
+            seq::pointer sp = find_by_number(seqno);
+            if (sp)
+                sp->set_song_mute(! bits.test(bit));    /* calls set_armed()  */
+        }
+    }
+    return result;
+}
+
 /**
  *  Copies the current bits status of the screenset's sequences into the given
  *  boolean vector.  The vector is cleared before adding in the new bits.
@@ -1386,6 +1422,38 @@ screenset::learn_bits (midibooleans & bits)
     return result;
 }
 
+/**
+ *  Copies the current armed statuses of the screenset's sequences into the
+ *  given bitset.  Bits of empty slots, and bits beyond the set size, are
+ *  cleared.
+ *
+ * \param [out] bits
+ *      Provides the destination for the sequence statuses.
+ *
+ * \return
+ *      Returns true if the bits were filled with statuses.
+ */
+
+bool
+screenset::learn_bits (armbits & bits)
+{
+    bool result = count() > 0;
+    bits.reset();
+    if (result)
+    {
+        int bit = 0;
+        int bitcount = std::min(m_set_size, c_max_set_size);
+        seq::number seqend = offset() + bitcount;
+        for (seq::number s = offset(); s != seqend; ++s, ++bit)
+        {
+            seq::pointer sp = find_by_number(s);
+            if (sp && sp->armed())
+                bits.set(bit);
+        }
+    }
+    return result;
+}
+
 std::string
 screenset::to_string (bool showseqs) const
 {
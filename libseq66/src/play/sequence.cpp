@@ -48,6 +48,7 @@
  *      point, and add better locking coverage if necessary.
  */
 
+#include <algorithm>                    /* std::sort(), std::lower_bound()  */
 #include <cstring>                      /* std::memset()                    */
 #include <cmath>                        /* std::trunc()                     */
 
@@ -87,6 +88,14 @@ static const double c_scale_min     =    0.01;
 static const double c_scale_max     =  200.00;
 static const double c_measure_max   = 1000.00;
 
+/**
+ *  The lock wait of sequence::play() is timed on one call in this many (a
+ *  power of 2), so that the two clock reads are not paid every frame.  The
+ *  histogram still gets a fair sample of the waits.
+ */
+
+static const unsigned c_lockwait_sample = 16;
+
 /*
  * Member value.  A fingerprint size of 0 means to not use a fingerprint...
  * display the whole track in the progress box, no matter how long.
@@ -156,6 +165,7 @@ sequence::sequence (int ppqn) :
     m_notes_on                  (0),
     m_master_bus                (nullptr),
     m_playing_notes             (),
+    m_emit_event                (),
     m_armed                     (false),
     m_recording                 (false),
     m_draw_locked               (false),
@@ -182,6 +192,12 @@ sequence::sequence (int ppqn) :
     m_dirty_edit                (true),
     m_dirty_perf                (true),
     m_dirty_names               (true),
+    m_edit_generation           (0),
+    m_note_index                (),
+    m_note_buckets              (),
+    m_note_shift                (0),
+    m_note_index_generation     (0),
+    m_note_index_count          (-1),           /* forces the first build   */
     m_is_modified               (false),
     m_seq_in_edit               (false),
     m_status                    (0),
@@ -190,6 +206,7 @@ sequence::sequence (int ppqn) :
     m_last_tick                 (0),
     m_queued_tick               (0),
     m_trigger_offset            (0),
+    m_play_count                (0),
     m_maxbeats                  (c_maxbeats),
     m_ppqn                      (choose_ppqn(ppqn)),
     m_seq_number                (unassigned()),
@@ -209,7 +226,7 @@ sequence::sequence (int ppqn) :
     m_musical_key               (usr().seqedit_key()),
     m_musical_scale             (usr().seqedit_scale()),
     m_background_sequence       (usr().seqedit_bgsequence()),
-    m_mutex                     ()
+    m_mutex                     ("sequence")
 {
     sm_preserve_velocity = usr().preserve_velocity();
     sm_fingerprint_size = usr().fingerprint_size();
@@ -291,6 +308,7 @@ sequence::partial_assign (const sequence & rhs, bool toclipboard)
         m_parent                    = rhs.m_parent;         /* a pointer    */
         m_events                    = rhs.m_events;         /* container!   */
         m_triggers                  = rhs.m_triggers;       /* 2021-07-27   */
+        ++m_edit_generation;                                /* note index   */
 
         /*
          *  The triggers class has a parent that cannot be reassigned.
@@ -643,6 +661,7 @@ sequence::pop_trigger_undo ()
 {
     automutex locker(m_mutex);
     m_triggers.pop_undo();
+    ++m_edit_generation;
 }
 
 /**
@@ -656,6 +675,7 @@ sequence::pop_trigger_redo ()
 {
     automutex locker(m_mutex);
     m_triggers.pop_redo();
+    ++m_edit_generation;
 }
 
 /**
@@ -1058,6 +1078,11 @@ sequence::toggle_queued ()
  *
  *  Can we somehow reset the times-played?
  *
+ *  The time spent waiting for the pattern lock is added to the lock-wait
+ *  histogram of the performer's playstats, for one call in
+ *  c_lockwait_sample.  The call count is touched only by the thread that
+ *  plays the pattern.
+ *
  * \param tick
  *      Provides the current end-tick value.  The tick comes in as a global
  *      tick.
@@ -1083,7 +1108,19 @@ sequence::play
     bool resumenoteons
 )
 {
+    bool sample = (++m_play_count & (c_lockwait_sample - 1)) == 0 &&
+        ! perf()->rendering();
+
+    long waitstart = sample ? playstats::now_ns() : 0 ;
     automutex locker(m_mutex);
+    if (sample)                             /* lock-wait statistic          */
+    {
+        perf()->play_stats().add
+        (
+            playstats::measure::lockwait, playstats::now_ns() - waitstart
+        );
+    }
+
     bool trigger_turning_off = false;       /* turn off after in-frame play */
     int trigtranspose = 0;                  /* used with c_trig_transpose   */
     midipulse start_tick = m_last_tick;     /* modified in triggers::play() */
@@ -1157,9 +1194,7 @@ sequence::play
             {
                 if (transpose != 0 && er.is_note()) /* includes Aftertouch  */
                 {
-                    event trans_event = er;         /* assign ALL members   */
-                    trans_event.transpose_note(transpose);
-                    put_event_on_bus(trans_event);
+                    put_event_on_bus(er, transpose);
                 }
                 else
                 {
@@ -1187,9 +1222,11 @@ sequence::play
                  * but it does prevent one CPU from being hammered at 100%.
                  * millisleep(1) made the live-grid progress bar jittery when
                  * unmuting shorter patterns, which play() relentlessly.
+                 * No sleep is needed when rendering offline.
                  */
 
-                (void) microsleep(1);
+                if (! perf()->rendering())
+                    (void) microsleep(1);
             }
         }
     }
@@ -1764,6 +1801,7 @@ sequence::select_note_events
 )
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     return m_events.select_note_events(tick_s, note_h, tick_f, note_l, action);
 }
 
@@ -1804,6 +1842,7 @@ sequence::select_events
 )
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     return m_events.select_events(tick_s, tick_f, status, cc, action);
 }
 
@@ -1836,6 +1875,7 @@ sequence::select_events (midibyte status, midibyte cc, bool inverse)
 {
     automutex locker(m_mutex);
     midibyte d0, d1;
+    ++m_edit_generation;
     for (auto & er : m_events)
     {
         er.get_data(d0, d1);
@@ -1872,6 +1912,7 @@ void
 sequence::select_all ()
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     m_events.select_all();
 }
 
@@ -1881,6 +1922,7 @@ sequence::select_by_channel (int channel)
     if (is_good_channel(midibyte(channel)))
     {
         automutex locker(m_mutex);
+        ++m_edit_generation;
         m_events.select_by_channel(channel);
     }
 }
@@ -1891,6 +1933,7 @@ sequence::select_notes_by_channel (int channel)
     if (is_good_channel(midibyte(channel)))
     {
         automutex locker(m_mutex);
+        ++m_edit_generation;
         m_events.select_notes_by_channel(channel);
     }
 }
@@ -1905,6 +1948,7 @@ void
 sequence::unselect ()
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     m_events.unselect_all();
 }
 
@@ -3568,7 +3612,8 @@ sequence::set_dirty_mp ()
 
 /**
  *  Call set_dirty_mp() and then sets the dirty flag for editing. Note that it
- *  does not call performer::modify().
+ *  does not call performer::modify(), but it does tell the performer that its
+ *  cached song extent might have changed.
  */
 
 void
@@ -3576,6 +3621,9 @@ sequence::set_dirty ()
 {
     set_dirty_mp();
     m_dirty_edit = true;
+    ++m_edit_generation;
+    if (not_nullptr(m_parent))
+        m_parent->invalidate_extent();
 }
 
 /**
@@ -4065,6 +4113,7 @@ sequence::adjust_trigger_offsets_to_length (midipulse newlength)
 {
     automutex locker(m_mutex);
     m_triggers.adjust_offsets_to_length(newlength);
+    ++m_edit_generation;
 }
 
 /**
@@ -4085,6 +4134,7 @@ sequence::copy_triggers (midipulse starttick, midipulse distance)
 {
     automutex locker(m_mutex);
     m_triggers.copy(starttick, distance);
+    ++m_edit_generation;
 }
 
 bool
@@ -4227,6 +4277,7 @@ sequence::offset_triggers (midipulse tick, triggers::grow editmode)
 {
     automutex locker(m_mutex);
     m_triggers.offset_selected(tick, editmode);
+    ++m_edit_generation;
 }
 
 /**
@@ -4252,6 +4303,34 @@ sequence::get_max_timestamp () const
     return m_events.get_max_timestamp();
 }
 
+/**
+ *  Gets the furthest point reached by this pattern:  the larger of its
+ *  length, its last event, and the end of its last trigger.  This replaces
+ *  three separate calls (and three locks) when calculating the extent of the
+ *  whole song.
+ *
+ * \threadsafe
+ *
+ * \return
+ *      Returns the maximum of the three values.
+ */
+
+midipulse
+sequence::get_max_extent () const
+{
+    automutex locker(m_mutex);
+    midipulse result = get_length();
+    midipulse t = m_events.get_max_timestamp();
+    if (t > result)
+        result = t;
+
+    t = m_triggers.get_maximum();
+    if (t > result)
+        result = t;
+
+    return result;
+}
+
 bool
 sequence::get_trigger_state (midipulse tick) const
 {
@@ -4302,6 +4381,7 @@ bool
 sequence::select_trigger (midipulse tick)
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     return m_triggers.select(tick);
 }
 
@@ -4316,6 +4396,7 @@ bool
 sequence::unselect_trigger (midipulse tick)
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     return m_triggers.unselect(tick);
 }
 
@@ -4330,6 +4411,7 @@ bool
 sequence::unselect_triggers ()
 {
     automutex locker(m_mutex);
+    ++m_edit_generation;
     return m_triggers.unselect();
 }
 
@@ -4363,6 +4445,7 @@ sequence::cut_selected_triggers ()
 {
     automutex locker(m_mutex);
     copy_selected_triggers();                   /* locks itself (recursive) */
+    ++m_edit_generation;
     return m_triggers.remove_selected();
 }
 
@@ -4398,6 +4481,7 @@ sequence::paste_trigger (midipulse paste_tick)
 {
     automutex locker(m_mutex);
     m_triggers.paste(paste_tick);
+    ++m_edit_generation;
     return true;
 }
 
@@ -4573,6 +4657,189 @@ sequence::get_next_note
     return draw::finish;
 }
 
+/**
+ *  Gets the notes (and tempo events) that overlap the given time range and
+ *  note range.  Unlike a walk with get_next_note(), this function uses a
+ *  time index, so that a zoomed-in view of a long pattern touches only the
+ *  visible notes.  Also unlike that walk, a note that starts before the
+ *  range and ends after it is included.
+ *
+ *  Each note_info also holds the draw type (linked, note_on, note_off, or
+ *  tempo) that get_next_note() would return for it.  The notes are returned
+ *  in the order of their starting times.
+ *
+ * \threadsafe
+ *
+ * \param tick_s
+ *      The start of the time range, inclusive.
+ *
+ * \param tick_f
+ *      The end of the time range, inclusive.
+ *
+ * \param note_l
+ *      The lowest note of interest, inclusive.
+ *
+ * \param note_h
+ *      The highest note of interest, inclusive.  Use 0 and c_notes_count - 1
+ *      to get all notes.  Note that tempo events have a pseudo-note value,
+ *      as in get_next_note().
+ *
+ * \param [out] notesout
+ *      Receives the notes.  It is cleared first.
+ *
+ * \return
+ *      Returns the number of notes found.  If an event action (e.g. a move)
+ *      is in progress, 0 is returned, just as get_next_note() bugs out.
+ */
+
+int
+sequence::notes_in_range
+(
+    midipulse tick_s, midipulse tick_f,
+    int note_l, int note_h, notelist & notesout
+) const
+{
+    automutex locker(m_mutex);
+    notesout.clear();
+    if (m_events.action_in_progress())          /* atomic boolean check     */
+        return 0;
+
+    bool stale = m_note_index_generation != m_edit_generation ||
+        m_note_index_count != m_events.count();
+
+    if (stale)
+        rebuild_note_index();
+
+    if (m_note_buckets.empty() || tick_f < tick_s)
+        return 0;
+
+    if (tick_s < 0)
+        tick_s = 0;
+
+    std::size_t b0 = std::size_t(tick_s >> m_note_shift);
+    std::size_t b1 = std::size_t(tick_f >> m_note_shift);
+    if (b1 >= m_note_buckets.size())
+        b1 = m_note_buckets.size() - 1;
+
+    std::vector<int> indices;
+    for (std::size_t b = b0; b <= b1; ++b)
+    {
+        for (int i : m_note_buckets[b])
+            indices.push_back(i);
+    }
+    std::sort(indices.begin(), indices.end());
+    auto last = std::unique(indices.begin(), indices.end());
+    for (auto i = indices.begin(); i != last; ++i)
+    {
+        const note_info & ni = m_note_index[std::size_t(*i)];
+        if (ni.note() < note_l || ni.note() > note_h)
+            continue;
+
+        bool overlap;
+        if (ni.draw_type() != draw::linked)
+            overlap = ni.start() >= tick_s && ni.start() <= tick_f;
+        else if (ni.finish() >= ni.start())
+            overlap = ni.start() <= tick_f && ni.finish() >= tick_s;
+        else                                    /* wrapped-around note      */
+            overlap = ni.start() <= tick_f || ni.finish() >= tick_s;
+
+        if (overlap)
+            notesout.push_back(ni);
+    }
+    return int(notesout.size());
+}
+
+/**
+ *  Rebuilds the note index used by notes_in_range().  The bucket size is the
+ *  smallest power of two that is at least a beat, so that a shift locates
+ *  a bucket.  A linked note is entered in every bucket it covers; a note
+ *  that wraps around the end of the pattern is entered in the buckets from
+ *  its start to the end, and from 0 to its finish.  Other items (unlinked
+ *  notes and tempo events) are entered only at their start.
+ *
+ *  Must be called with m_mutex held.
+ */
+
+void
+sequence::rebuild_note_index () const
+{
+    m_note_index.clear();
+    m_note_buckets.clear();
+    m_note_index_generation = m_edit_generation;
+    m_note_index_count = m_events.count();
+    m_note_shift = 0;
+    while ((midipulse(1) << m_note_shift) < midipulse(m_ppqn))
+        ++m_note_shift;
+
+    midipulse maxtick = get_length();
+    for (auto evi = m_events.cbegin(); evi != m_events.cend(); ++evi)
+    {
+        note_info ni;
+        draw dt = get_note_info(ni, evi);
+        if (dt != draw::none)
+        {
+            ni.ni_draw = dt;
+            if (ni.start() > maxtick)
+                maxtick = ni.start();
+
+            if (dt == draw::linked && ni.finish() > maxtick)
+                maxtick = ni.finish();
+
+            m_note_index.push_back(ni);
+        }
+    }
+    m_note_buckets.resize(std::size_t(maxtick >> m_note_shift) + 1);
+
+    int index = 0;
+    for (const auto & ni : m_note_index)
+    {
+        bool linked = ni.draw_type() == draw::linked;
+        midipulse finish = linked ? ni.finish() : ni.start() ;
+        std::size_t b0 = std::size_t(ni.start() >> m_note_shift);
+        std::size_t b1 = std::size_t(finish >> m_note_shift);
+        if (finish >= ni.start())
+        {
+            for (std::size_t b = b0; b <= b1; ++b)
+                m_note_buckets[b].push_back(index);
+        }
+        else
+        {
+            for (std::size_t b = b0; b < m_note_buckets.size(); ++b)
+                m_note_buckets[b].push_back(index);
+
+            for (std::size_t b = 0; b <= b1; ++b)
+                m_note_buckets[b].push_back(index);
+        }
+        ++index;
+    }
+}
+
+/**
+ *  Gets an iterator to the first event at or after the given tick.  Since
+ *  the events are kept sorted by time, this is a binary search.  Used to
+ *  start a get_next_event_match() loop at the left edge of a view.
+ *
+ * \param tick
+ *      The tick of interest.
+ *
+ * \return
+ *      Returns the iterator, which can be checked with cend().
+ */
+
+event::buffer::const_iterator
+sequence::cbegin (midipulse tick) const
+{
+    automutex locker(m_mutex);
+    return std::lower_bound
+    (
+        m_events.cbegin(), m_events.cend(), tick,
+        [] (const event & ev, midipulse t)
+        {
+            return ev.timestamp() < t;
+        }
+    );
+}
+
 /**
  *  Copies important information for drawing a note event.
  *
@@ -5563,16 +5830,35 @@ sequence::to_string () const
  *  Note that the call to midi_channel() yields the event channel if
  *  free_channel() is true.  Otherwise the global pattern channel is true.
  *
+ *  Channel messages are not copied into a new event.  Only the status, data,
+ *  and current tick are written into m_emit_event, with the transposition
+ *  applied to the note number on the way.  System messages (SysEx and meta
+ *  events included), rare here, are still copied whole, to carry their data.
+ *
  * \param ev
  *      The event to put on the buss.
  *
+ * \param transpose
+ *      The amount to transpose a note or aftertouch event.  The caller
+ *      checks that the event is one of these.  If the transposed note is out
+ *      of range, the note is not transposed, as in event::transpose_note().
+ *      Defaults to 0.
+ *
  * \threadsafe
+ *      The caller must hold m_mutex.
  */
 
 void
-sequence::put_event_on_bus (const event & ev)
+sequence::put_event_on_bus (const event & ev, int transpose)
 {
     midibyte note = ev.get_note();
+    if (transpose != 0)
+    {
+        int tnote = int(note) + transpose;
+        if (tnote >= 0 && tnote < c_midibyte_data_max)
+            note = midibyte(tnote);
+    }
+
     bool skip = false;
     if (ev.is_note_on())
     {
@@ -5587,9 +5873,25 @@ sequence::put_event_on_bus (const event & ev)
     }
     if (! skip)
     {
-        event evout;
-        evout.prep_for_send(m_parent->get_tick(), ev);      /* issue #100   */
-        master_bus()->play_and_flush(m_true_bus, &evout, midi_channel(ev));
+        midipulse tick = m_parent->get_tick();              /* issue #100   */
+        if (ev.get_status() >= EVENT_MIDI_SYSEX)            /* not channel  */
+        {
+            event evout;
+            evout.prep_for_send(tick, ev);
+            master_bus()->play_and_flush(m_true_bus, &evout, midi_channel(ev));
+        }
+        else
+        {
+            midibyte d0, d1;
+            ev.get_data(d0, d1);
+            m_emit_event.set_timestamp(tick);
+            m_emit_event.set_status_keep_channel(ev.get_status());
+            m_emit_event.set_data(transpose != 0 ? note : d0, d1);
+            master_bus()->play_and_flush
+            (
+                m_true_bus, &m_emit_event, midi_channel(ev)
+            );
+        }
     }
 }
 
@@ -6036,6 +6338,10 @@ sequence::set_parent (performer * p)
  * \param playbackmode
  *      If true, we are in Song mode.  Otherwise, Live mode.
  *
+ *  The time taken is added to the pattern's cost in the performer's
+ *  playstats, except while rendering, so that both performer::play() and
+ *  the play_all_sets() path through screenset::play() are costed.
+ *
  * \param resumenoteons
  *      Indicates if we are to resume Note Ons.  Used by performer::play().
  */
@@ -6043,6 +6349,8 @@ sequence::set_parent (performer * p)
 void
 sequence::play_queue (midipulse tick, bool playbackmode, bool resumenoteons)
 {
+    bool costed = ! perf()->rendering();
+    long t0 = costed ? playstats::now_ns() : 0 ;
     if (check_queued_tick(tick))
     {
         play(get_queued_tick() - 1, playbackmode, resumenoteons);
@@ -6070,6 +6378,11 @@ sequence::play_queue (midipulse tick, bool playbackmode, bool resumenoteons)
     {
         play(tick, playbackmode, resumenoteons);
     }
+    if (costed)
+    {
+        long ns = playstats::now_ns() - t0;
+        perf()->play_stats().add_sequence_cost(seq_number(), ns);
+    }
 }
 
 /**
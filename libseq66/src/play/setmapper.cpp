@@ -126,7 +126,10 @@ setmapper::setmapper
     m_edit_sequence         (seq::unassigned()),
     m_playscreen            (seq::unassigned()),
     m_playscreen_pointer    (nullptr),
-    m_tracks_mute_state     (m_set_size, false)
+    m_tracks_mute_state     (m_set_size, false),
+    m_pending_bits          (),
+    m_bits_pending          (false),
+    m_pending_mutex         ()
 {
     (void) reset();
 }
@@ -601,6 +604,11 @@ setmapper::max_timestamp () const
     return result;
 }
 
+/**
+ *  Gets the song extent over all sets.  Used by performer::get_max_extent(),
+ *  which caches the result.
+ */
+
 midipulse
 setmapper::max_extent () const
 {
@@ -927,6 +935,62 @@ setmapper::set_playing_screenset (screenset::number setno)
  * -------------------------------------------------------------------------
  */
 
+/**
+ *  Stores the armed statuses for the play-screen, replacing any not yet
+ *  applied.  The output thread applies them in apply_pending_bits().
+ */
+
+void
+setmapper::publish_bits (const screenset::armbits & bits)
+{
+    std::lock_guard<std::mutex> lk(m_pending_mutex);
+    m_pending_bits = bits;
+    m_bits_pending = true;
+}
+
+/**
+ *  Applies the armed statuses stored by the last mute-group operation, if
+ *  any, to the current play-screen.  Called at the start of each output
+ *  frame, and by the performer when not playing.
+ *
+ * \return
+ *      Returns true if statuses were pending and were applied.
+ */
+
+bool
+setmapper::apply_pending_bits ()
+{
+    bool result = m_bits_pending;
+    if (result)
+    {
+        screenset::armbits bits;
+        {
+            std::lock_guard<std::mutex> lk(m_pending_mutex);
+            bits = m_pending_bits;
+            m_bits_pending = false;
+        }
+        result = play_screen()->apply_bits(bits);
+    }
+    return result;
+}
+
+/**
+ *  Gets the armed statuses of the play-screen as they will be at the next
+ *  output frame:  the pending statuses if any, else the current statuses.
+ */
+
+bool
+setmapper::learn_pending_bits (screenset::armbits & bits)
+{
+    std::lock_guard<std::mutex> lk(m_pending_mutex);
+    if (m_bits_pending)
+    {
+        bits = m_pending_bits;
+        return true;
+    }
+    return play_screen()->learn_bits(bits);
+}
+
 /**
  *  Applies a mute group to the current play-screen.
  */
@@ -934,10 +998,10 @@ setmapper::set_playing_screenset (screenset::number setno)
 bool
 setmapper::apply_mutes (mutegroup::number group)
 {
-    midibooleans bits;
+    screenset::armbits bits;
     bool result = mutes().apply(group, bits);
     if (result)
-        result = play_screen()->apply_bits(bits);
+        publish_bits(bits);
 
     return result;
 }
@@ -949,10 +1013,10 @@ setmapper::apply_mutes (mutegroup::number group)
 bool
 setmapper::unapply_mutes (mutegroup::number group)
 {
-    midibooleans bits;
+    screenset::armbits bits;
     bool result = mutes().unapply(group, bits);
     if (result)
-        result = play_screen()->apply_bits(bits);
+        publish_bits(bits);
 
     return result;
 }
@@ -971,10 +1035,10 @@ setmapper::unapply_mutes (mutegroup::number group)
 bool
 setmapper::toggle_mutes (mutegroup::number group)
 {
-    midibooleans bits;
+    screenset::armbits bits;
     bool result = mutes().toggle(group, bits);
     if (result)
-        result = play_screen()->apply_bits(bits);
+        publish_bits(bits);
 
     return result;
 }
@@ -982,13 +1046,13 @@ setmapper::toggle_mutes (mutegroup::number group)
 bool
 setmapper::toggle_active_mutes (mutegroup::number group)
 {
-    midibooleans armedbits;
-    bool result = play_screen()->learn_bits(armedbits);
+    screenset::armbits armedbits;
+    bool result = learn_pending_bits(armedbits);
     if (result)
     {
         result = mutes().toggle_active(group, armedbits);
         if (result)
-            result = play_screen()->apply_bits(armedbits);
+            publish_bits(armedbits);
     }
     return result;
 }
@@ -33,8 +33,12 @@
  *  the playing (current) screenset.
  */
 
+#include <algorithm>                    /* std::min()                       */
+#include <atomic>                       /* std::atomic<bool>                */
+#include <future>                       /* std::async(), std::future<>      */
 #include <iostream>                     /* std::cout                        */
 #include <sstream>                      /* std::ostringstream               */
+#include <thread>                       /* std::thread::hardware_concur...  */
 
 #include "cfg/settings.hpp"             /* seq66::usr()                     */
 #include "play/setmaster.hpp"           /* seq66::setmaster class           */
@@ -47,6 +51,14 @@
 namespace seq66
 {
 
+/**
+ *  The fewest patterns worth giving to a thread of its own in
+ *  exec_parallel_function().  Below this, starting the thread costs more
+ *  than it saves.
+ */
+
+static const int c_min_patterns_per_thread = 16;
+
 /**
  *  Creates a manager for all of the sets in a tune, at set level.  It also
  *  provides access to the container of sets and to the currently-selected set,
@@ -302,6 +314,80 @@ setmaster::exec_set_function (screenset::slothandler p)
     return result;
 }
 
+/**
+ *  Runs a slot-handler for each existing pattern in each set, spreading the
+ *  patterns over a few threads.  Empty slots are skipped.  The caller waits
+ *  until all of the threads are done.
+ *
+ *  The handler is called for different patterns at the same time, so it must
+ *  touch only its own pattern (which locks its own mutex) and data that is
+ *  itself thread-safe.  The set container is not changed meanwhile, as it is
+ *  changed only by the caller's thread.  The performer's change
+ *  notifications and pattern announcements are not thread-safe, so the
+ *  handler should hold a performer::notify_deferral, and the caller should
+ *  notify once when this function returns.
+ *
+ * \param p
+ *      The slot-handler.
+ *
+ * \return
+ *      Returns true if the handler returned true for every pattern.
+ */
+
+bool
+setmaster::exec_parallel_function (screenset::slothandler p)
+{
+    std::vector<std::pair<seq::pointer, seq::number>> patterns;
+    for (auto & sset : m_container)                 /* screenset reference  */
+    {
+        if (sset.second.usable())
+        {
+            (void) sset.second.exec_slot_function
+            (
+                [&patterns] (seq::pointer sp, seq::number sn)
+                {
+                    if (sp)
+                        patterns.emplace_back(sp, sn);
+
+                    return true;
+                }
+            );
+        }
+    }
+
+    int count = int(patterns.size());
+    int cpus = int(std::thread::hardware_concurrency());
+    int threads = std::min(cpus, count / c_min_patterns_per_thread);
+    std::atomic<bool> result(true);
+    auto worker = [&patterns, &result, &p, count] (int first, int stride)
+    {
+        for (int i = first; i < count; i += stride)
+        {
+            if (! p(patterns[i].first, patterns[i].second))
+                result = false;
+        }
+    };
+    if (threads > 1)
+    {
+        std::vector<std::future<void>> futures;
+        for (int t = 1; t < threads; ++t)
+        {
+            futures.push_back
+            (
+                std::async(std::launch::async, worker, t, threads)
+            );
+        }
+
+        worker(0, threads);                         /* this thread helps    */
+        for (auto & f : futures)
+            f.get();
+    }
+    else
+        worker(0, 1);
+
+    return result;
+}
+
 /**
  *  Does a brute-force lookup of the given set number, obtained by screenset
  *  :: set_number().  We must use the long form of the for loop here, as far
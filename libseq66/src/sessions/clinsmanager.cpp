@@ -34,9 +34,11 @@
 
 #include "cfg/cmdlineopts.hpp"          /* command-line functions           */
 #include "cfg/settings.hpp"             /* seq66::usr() and seq66::rc()     */
+#include "midi/midifile.hpp"            /* seq66::render_midi_file()        */
 #include "os/daemonize.hpp"             /* seq66::session_setup(), _close() */
 #include "os/timing.hpp"                /* seq66::millisleep()              */
 #include "sessions/clinsmanager.hpp"    /* seq66::clinsmanager class        */
+#include "util/asynclog.hpp"            /* seq66::log_sink()                */
 #include "util/filefunctions.hpp"       /* seq66::pathname_concatenate()    */
 #include "util/strfunctions.hpp"        /* seq66::contains()                */
 
@@ -47,6 +49,13 @@
 namespace seq66
 {
 
+/**
+ *  How often, in the --verbose case, run() shows the timing statistics of
+ *  the output thread while playback is running.
+ */
+
+static const long c_play_stats_period_ms = 10000;
+
 /**
  *  Note that this object is created before there is any chance to get the
  *  configuration, because the smanager base class is what gets the
@@ -66,7 +75,7 @@ clinsmanager::clinsmanager (const std::string & caps) :
 
 clinsmanager::~clinsmanager ()
 {
-    // no code
+    log_sink(nullptr);                  /* the sink calls this object       */
 }
 
 /**
@@ -141,6 +150,9 @@ clinsmanager::detect_session (std::string & url)
  *
  *  If all is well, a new nsmclient is created, and an announce/open handshake
  *  starts.  This function is called before create_window().
+ *
+ *  In any case, the messages of the log are then routed to
+ *  log_to_session().
  */
 
 bool
@@ -186,14 +198,61 @@ clinsmanager::create_session (int argc, char * argv [])
         nsm_active(result);                             /* class flag       */
         usr().in_nsm_session(result);                   /* global flag      */
         (void) smanager::create_session(argc, argv);
+        route_log();
         return result;
     }
-    else
+#endif
+    bool result = smanager::create_session(argc, argv);
+    route_log();
+    return result;
+}
+
+/**
+ *  Installs the log sink that hands each message written to
+ *  log_to_session().  The sink is removed by close_session() and the
+ *  destructors, before the objects it reaches are gone.
+ */
+
+void
+clinsmanager::route_log ()
+{
+    log_sink
+    (
+        [this] (msglevel lev, const std::string & text)
+        {
+            log_to_session(lev, text);
+        }
+    );
+}
+
+/**
+ *  Receives each message of the log after it is written to the console,
+ *  in the log's writer thread or the main thread.  Warnings and errors are
+ *  sent to the session manager as "/nsm/client/message", which it shows as
+ *  the client's status.  The session messages are not sent, since sending
+ *  is itself reported at that level.
+ *
+ * \param lev
+ *      The level of the message.
+ *
+ * \param text
+ *      The text of the message, without the client tag.
+ */
+
+void
+clinsmanager::log_to_session (msglevel lev, const std::string & text)
+{
+#if defined SEQ66_NSM_SUPPORT
+    if (nsm_active() && m_nsm_client)
     {
-        return smanager::create_session(argc, argv);
+        if (lev == msglevel::error)
+            (void) m_nsm_client->send_status(2, text);
+        else if (lev == msglevel::warn)
+            (void) m_nsm_client->send_status(1, text);
     }
 #else
-    return smanager::create_session(argc, argv);
+    (void) lev;
+    (void) text;
 #endif
 }
 
@@ -204,6 +263,7 @@ clinsmanager::create_session (int argc, char * argv [])
 bool
 clinsmanager::close_session (std::string & msg, bool ok)
 {
+    log_sink(nullptr);
 #if defined SEQ66_NSM_SUPPORT
     if (usr().in_nsm_session())
     {
@@ -281,16 +341,46 @@ clinsmanager::save_session (std::string & msg, bool ok)
 /**
  *  This function is useful in the command-line version of the application.
  *  For the Qt version, see the qt5nsmanager class.
+ *
+ *  If "-o bounce=filename" was given, the song is rendered offline to that
+ *  file instead, and this function returns at once.
+ *
+ *  With --verbose, the output-thread statistics, and the lock profile if
+ *  built in, are shown every ten seconds while playback runs.  See
+ *  performer::play_stats() and recmutex::profile_report().
  */
 
 bool
 clinsmanager::run ()
 {
+    std::string bouncefile = usr().option_bounce();
+    if (! bouncefile.empty())
+    {
+        std::string msg;
+        bool result = render_midi_file(*perf(), bouncefile, msg);
+        if (! result)
+            (void) seq66::error_message(msg);
+
+        return result;
+    }
+
     bool result = false;
+    long statstime = millitime();
     session_setup();
     while (! session_close())
     {
         result = true;
+        if (rc().verbose() && perf()->is_running())
+        {
+            long now = millitime();
+            if (now - statstime >= c_play_stats_period_ms)
+            {
+                statstime = now;
+                (void) info_message(perf()->play_stats().report());
+                if (recmutex::profiling())
+                    (void) info_message(recmutex::profile_report());
+            }
+        }
         if (session_save())
         {
             std::string msg;
@@ -38,9 +38,11 @@
  *         of command-line options and files.  It saves the MIDI file-name, if
  *         provided.
  *      -# Call create_performer(), which could delete an existing performer.
- *         It then launches the performer.  Save the unique-pointer.
+ *         It starts reading the note-map, if specified and possible, in its
+ *         own thread, launches the performer, and then installs the
+ *         note-mapper.  Save the unique-pointer.
  *      -# Call open_playlist().  It will open it, if specified and possible.
- e      -# Call open_note_mapper().  It will open it, if specified and possible.
+ *         Only the current list is verified; the rest are verified lazily.
  *      -# If the MIDI file-name is set, open it via a call to open_midi_file().
  *      -# If a user-interface is needed, create a unique-pointer to it, then
  *         show it.  This will remove any previous pointer.  The function is
@@ -68,6 +70,8 @@
 #include "play/playlist.hpp"            /* seq66::playlist class            */
 #include "sessions/smanager.hpp"        /* seq66::smanager()                */
 #include "os/daemonize.hpp"             /* seq66::reroute_stdio()           */
+#include "os/timing.hpp"                /* seq66::microtime()               */
+#include "util/asynclog.hpp"            /* seq66::async_log_start()         */
 #include "util/basic_macros.hpp"        /* seq66::msgprintf()               */
 #include "util/filefunctions.hpp"       /* seq66::file_readable() etc.      */
 
@@ -99,7 +103,12 @@ smanager::smanager (const std::string & caps) :
     m_is_help               (false),
     m_last_dirty_status     (false),
     m_extant_errmsg         (),
-    m_extant_msg_active     (false)
+    m_extant_msg_active     (false),
+    m_note_map_reader       (),
+    m_note_mapper           (),
+    m_note_map_errmsg       (),
+    m_startup_phases        (),
+    m_phase_start           (microtime())
 {
     /*
      * This has to wait: m_perf_pointer = create_performer();
@@ -119,6 +128,8 @@ smanager::~smanager ()
 {
     if (! is_help())
         (void) session_message("Exiting session manager");
+
+    async_log_stop();                   /* writes anything still queued     */
 }
 
 /**
@@ -326,7 +337,9 @@ smanager::create_performer ()
     {
         (void) p->get_settings(rc(), usr());
         m_perf_pointer = std::move(p);              /* change the ownership */
+        start_note_mapper();                        /* read during launch   */
         result = perf()->launch(ppqn);
+        (void) install_note_mapper();               /* always join reader   */
         if (! result)
         {
             errprint("performer launch failed");
@@ -339,6 +352,108 @@ smanager::create_performer ()
     return result;
 }
 
+/**
+ *  Starts reading the note-map file, if one is active, in a thread of its
+ *  own.  The file does not depend on the performer, so it can be read while
+ *  the performer is launched, which opens the MIDI ports and can take a
+ *  while.  The 'rc' settings must be complete before this call, because
+ *  they are read by the thread.  Also, the parser reports errors through
+ *  the static configfile error message, so no other configuration file may
+ *  be parsed until install_note_mapper() has joined the thread;
+ *  performer::launch() parses none.
+ */
+
+void
+smanager::start_note_mapper ()
+{
+    std::string notemapname = rc().notemap_filespec();
+    if (! notemapname.empty() && rc().notemap_active())
+    {
+        m_note_mapper.reset(new (std::nothrow) notemapper());
+        if (m_note_mapper)
+        {
+            notemapper & nm = *m_note_mapper;
+            std::string & errmsg = m_note_map_errmsg;
+            m_note_map_reader = std::async
+            (
+                std::launch::async, [&nm, notemapname, &errmsg] ()
+                {
+                    return read_notemapper(nm, notemapname, errmsg);
+                }
+            );
+        }
+    }
+}
+
+/**
+ *  Waits for the note-map file started by start_note_mapper() to be read,
+ *  and hands the note-mapper to the performer.  The performer refreshes the
+ *  note-map of the MIDI thru routes, so this can be called after launch.
+ *
+ * \return
+ *      Returns true if a note-mapper was read and installed.
+ */
+
+bool
+smanager::install_note_mapper ()
+{
+    bool result = m_note_map_reader.valid();
+    if (result)
+    {
+        result = m_note_map_reader.get();
+        if (result)
+        {
+            if (not_nullptr(perf()))
+                perf()->note_mapper(std::move(m_note_mapper));
+        }
+        else
+            append_error_message(m_note_map_errmsg);
+
+        m_note_mapper.reset();
+    }
+    return result;
+}
+
+/**
+ *  Ends the current startup phase, saving its name and duration, and starts
+ *  the next phase.
+ *
+ * \param name
+ *      The name of the phase that just ended.
+ */
+
+void
+smanager::startup_phase (const std::string & name)
+{
+    long now = microtime();
+    m_startup_phases.emplace_back(name, now - m_phase_start);
+    m_phase_start = now;
+}
+
+/**
+ *  Shows the duration of each startup phase, and the total.
+ */
+
+void
+smanager::show_startup_phases () const
+{
+    long total = 0;
+    for (const auto & phase : m_startup_phases)
+    {
+        msgprintf
+        (
+            msglevel::status, "Startup %-16s %8.3f ms",
+            phase.first.c_str(), double(phase.second) / 1000.0
+        );
+        total += phase.second;
+    }
+    msgprintf
+    (
+        msglevel::status, "Startup %-16s %8.3f ms",
+        "total", double(total) / 1000.0
+    );
+}
+
 /**
  *  Code moved from rcfile to here while researching issue #89.
  */
@@ -398,27 +513,6 @@ smanager::open_playlist ()
     return result;
 }
 
-bool
-smanager::open_note_mapper ()
-{
-    bool result = not_nullptr(perf());
-    if (result)
-    {
-        std::string notemapname = rc().notemap_filespec();
-        if (! notemapname.empty())
-        {
-            result = perf()->open_note_mapper(notemapname);
-            if (! result)
-                result = true;                          /* avoid early exit  */
-        }
-    }
-    else
-    {
-        append_error_message("Open note-mapper: no performer");
-    }
-    return result;
-}
-
 /**
  *  Encapsulates opening the MIDI file, if specified (on the command-line).
  *
@@ -789,11 +883,12 @@ smanager::error_handling ()
  *  Call sequence summary:
  *
  *      -   main_settings()
+ *      -   async_log_start(), so that the I/O threads do not block on output
  *      -   create_session()
  *      -   create_project()
- *      -   create_performer()
+ *      -   create_performer(), which reads the note-map in its own thread
+ *          while the performer is launched, then installs the note-mapper
  *      -   open_playlist()
- *      -   open_note_mapper()
  *      -   open_midi_file() if specified on command-line; otherwise
  *      -   Open most-recent file if that option is enabled:
  *          Get full path to the most recently-opened or imported file.  What if
@@ -807,10 +902,16 @@ smanager::error_handling ()
 bool
 smanager::create (int argc, char * argv [])
 {
+    m_phase_start = microtime();
+
     bool result = main_settings(argc, argv);
+    startup_phase("settings");
     if (result)
     {
+        (void) async_log_start();       /* other threads now log via a ring */
+
         bool ok = create_session(argc, argv);   /* get path, client ID, etc */
+        startup_phase("session");
         if (ok)
         {
             std::string homedir = manager_path();
@@ -819,16 +920,19 @@ smanager::create (int argc, char * argv [])
 
             file_message("Session manager path", homedir);
             (void) create_project(argc, argv, homedir);
+            startup_phase("project");
         }
         if (ok)
+        {
             (void) open_midi_control_file();
-
+            startup_phase("midi-control");
+        }
         result = create_performer();        /* fails if performer not made  */
+        startup_phase("performer");
         if (result)
         {
             result = open_playlist();
-            if (result)
-                result = open_note_mapper();
+            startup_phase("playlist");
         }
         if (result)
         {
@@ -866,9 +970,14 @@ smanager::create (int argc, char * argv [])
                 }
             }
         }
+        startup_phase("midi-file");
         if (result)
         {
             result = create_window();
+            startup_phase("window");
+            if (rc().verbose() || rc().investigate())
+                show_startup_phases();
+
             if (result)
             {
                 error_handling();
@@ -0,0 +1,589 @@
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          asynclog.cpp
+ *
+ *  This module defines the back-end that writes the console messages.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  The ring is a bounded multi-producer queue in the manner of Dmitry
+ *  Vyukov's: each record has a sequence number that tells a producer whether
+ *  the record is free, and the single consumer whether it is filled.  A
+ *  producer that finds the ring full drops its message and counts it, rather
+ *  than wait.  Each record holds a fixed-size buffer, into which the
+ *  producer copies or formats the text directly, so pushing does not
+ *  allocate.
+ *
+ *  A count of the producers inside async_log() lets async_log_stop() wait
+ *  for them, so that no message is put in the ring after the last drain.
+ *
+ *  A message whose level is turned off is dropped before it is queued or
+ *  formatted, so a disabled level costs the caller only a load of the
+ *  level mask.
+ */
+
+#include <atomic>                       /* std::atomic<>                    */
+#include <chrono>                       /* std::chrono::milliseconds        */
+#include <cstdio>                       /* std::vsnprintf()                 */
+#include <cstring>                      /* std::memcpy()                    */
+#include <iostream>                     /* std::cout, std::cerr             */
+#include <mutex>                        /* std::mutex, std::lock_guard      */
+#include <system_error>                 /* std::system_error                */
+#include <thread>                       /* std::thread                      */
+
+#include "util/asynclog.hpp"            /* seq66::async_log() etc.          */
+#include "util/basic_macros.hpp"        /* not_nullptr(), is_nullptr()      */
+
+#if defined SEQ66_PLATFORM_UNIX
+#include <unistd.h>                     /* STDERR_FILENO                    */
+#endif
+
+#if defined SEQ66_PLATFORM_WINDOWS      /* Microsoft platform               */
+#include <io.h>                         /* C::_write()                      */
+#endif
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  The number of records in the ring, a power of 2.  The longest message
+ *  held, including the terminator.  Longer messages are truncated.
+ */
+
+static const std::size_t c_log_ring_size    = 256;
+static const std::size_t c_log_ring_mask    = c_log_ring_size - 1;
+static const std::size_t c_log_text_size    = 256;
+
+/**
+ *  How long the writer thread sleeps when the ring is empty.
+ */
+
+static const int c_log_idle_ms = 10;
+
+/**
+ *  One message in the ring.
+ */
+
+struct logrecord
+{
+    std::atomic<std::size_t> lr_sequence;   /**< Free/filled marker.        */
+    msglevel lr_level;                      /**< The level of the message.  */
+    char lr_text[c_log_text_size];          /**< The text, null-terminated. */
+};
+
+static logrecord s_ring[c_log_ring_size];
+static std::atomic<std::size_t> s_enqueue_pos(0);
+static std::size_t s_dequeue_pos = 0;       /* used only by the writer      */
+static std::atomic<unsigned> s_dropped(0);
+static std::atomic<bool> s_active(false);
+static std::atomic<bool> s_stopping(false);
+static std::atomic<int> s_producers(0);
+static std::thread::id s_main_thread;
+
+/**
+ *  Serializes the writing of whole messages to the console streams.  Never
+ *  locked by a thread that pushes into the ring.
+ */
+
+static std::mutex s_write_mutex;
+
+/**
+ *  Guards the sink.  It is held while the sink is called, so that
+ *  log_sink() does not return while the old sink is still running, and the
+ *  owner of the sink can then be destroyed safely.
+ */
+
+static std::mutex s_sink_mutex;
+static logsink s_sink;
+
+/**
+ *  Set while this thread is in the sink, so that a message the sink itself
+ *  writes is not passed back to it.
+ */
+
+static thread_local bool t_in_sink = false;
+
+/**
+ *  One bit per msglevel value; a set bit means the level is shown.  The
+ *  info and debug levels start off, to match the default of verbose() and
+ *  investigate(); set_verbose(), set_investigate(), and set_quiet() change
+ *  them.
+ */
+
+static std::atomic<unsigned> s_level_mask
+(
+    ~((1u << unsigned(msglevel::info)) | (1u << unsigned(msglevel::debug)))
+);
+
+static const char * s_black  = "\033[1;30m";
+static const char * s_normal = "\033[0m";
+
+/**
+ *  Owns the writer thread.  Its destructor stops and joins the thread at
+ *  exit, in case async_log_stop() was never called, since destroying a
+ *  joinable std::thread calls std::terminate().  It is defined after the
+ *  ring and the mutex, so it is destroyed before them.
+ */
+
+static struct logwriter
+{
+    std::thread lw_thread;
+
+    ~logwriter ()
+    {
+        async_log_stop();
+    }
+
+} s_writer;
+
+/**
+ *  Enables or disables the messages of one level at run-time.
+ */
+
+void
+log_level (msglevel lev, bool enable)
+{
+    unsigned bit = 1u << unsigned(lev);
+    if (enable)
+        s_level_mask |= bit;
+    else
+        s_level_mask &= ~bit;
+}
+
+/**
+ * \return
+ *      Returns true if messages of the given level are shown.
+ */
+
+bool
+log_level (msglevel lev)
+{
+    unsigned bit = 1u << unsigned(lev);
+    return (s_level_mask & bit) != 0;
+}
+
+/**
+ *  Installs the function that receives each message after it is written to
+ *  the console.  Pass an empty function to remove it; this waits for a call
+ *  of the old sink in progress to finish.
+ */
+
+void
+log_sink (logsink s)
+{
+    std::lock_guard<std::mutex> lock(s_sink_mutex);
+    s_sink = s;
+}
+
+/**
+ *  Writes one message, with the client tag and a newline, to standard
+ *  output (none, info, status, and session levels) or standard error (warn,
+ *  error, and debug levels), then passes it to the sink, if any.
+ */
+
+void
+log_write (msglevel lev, const std::string & text)
+{
+    bool iserror = lev == msglevel::error || lev == msglevel::warn ||
+        lev == msglevel::debug;
+
+    std::string tag = seq_client_tag(lev);
+    {
+        std::lock_guard<std::mutex> lock(s_write_mutex);
+        if (iserror)
+        {
+            std::cerr << tag << " ";
+            if (lev == msglevel::debug && is_a_tty(STDERR_FILENO))
+                std::cerr << s_black << text << s_normal << std::endl;
+            else
+                std::cerr << text << std::endl;
+        }
+        else
+            std::cout << tag << " " << text << std::endl;
+    }
+    if (! t_in_sink)
+    {
+        std::lock_guard<std::mutex> lock(s_sink_mutex);
+        if (s_sink)
+        {
+            t_in_sink = true;
+            s_sink(lev, text);
+            t_in_sink = false;
+        }
+    }
+}
+
+/**
+ *  Counts a producer in for the life of the object, so that
+ *  async_log_stop() can wait for it.  The count is raised before s_active
+ *  is checked, so a producer either sees the log stopped or is waited for.
+ */
+
+class logproducer
+{
+
+public:
+
+    logproducer ()
+    {
+        ++s_producers;
+    }
+
+    ~logproducer ()
+    {
+        --s_producers;
+    }
+
+    bool active () const
+    {
+        return s_active && std::this_thread::get_id() != s_main_thread;
+    }
+
+};
+
+/**
+ *  Claims the next free record of the ring.
+ *
+ * \param [out] pos
+ *      Set to the enqueue position of the record, needed to publish it.
+ *
+ * \return
+ *      Returns the record, or null if the ring is full, in which case the
+ *      drop is counted.
+ */
+
+static logrecord *
+claim_record (std::size_t & pos)
+{
+    pos = s_enqueue_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        logrecord * r = &s_ring[pos & c_log_ring_mask];
+        std::size_t seq = r->lr_sequence.load(std::memory_order_acquire);
+        long dif = long(seq) - long(pos);
+        if (dif == 0)
+        {
+            if
+            (
+                s_enqueue_pos.compare_exchange_weak
+                (
+                    pos, pos + 1, std::memory_order_relaxed
+                )
+            )
+            {
+                return r;
+            }
+        }
+        else if (dif < 0)
+        {
+            ++s_dropped;                            /* ring is full         */
+            return nullptr;
+        }
+        else
+            pos = s_enqueue_pos.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ *  Hands a filled record to the writer thread.
+ */
+
+static void
+publish_record (logrecord * r, std::size_t pos, msglevel lev)
+{
+    r->lr_level = lev;
+    r->lr_sequence.store(pos + 1, std::memory_order_release);
+}
+
+/**
+ *  Copies the parts of a message into a record of the ring for the writer
+ *  thread.  Lock-free, and does not allocate.
+ *
+ * \param lev
+ *      The level of the message.
+ *
+ * \param parts
+ *      The pieces of the text, which are joined without separators.  A null
+ *      piece is skipped.
+ *
+ * \param count
+ *      The number of pieces.
+ *
+ * \return
+ *      Returns true if the message was taken care of, even if dropped
+ *      because its level is turned off or the ring is full.  Returns false
+ *      if the log is not running, or this is the main thread, in which case
+ *      the caller writes the message itself.
+ */
+
+bool
+async_log (msglevel lev, const char * const parts [], int count)
+{
+    if (! log_level(lev))
+        return true;                                /* level is turned off  */
+
+    logproducer producer;
+    if (! producer.active())
+        return false;
+
+    std::size_t pos;
+    logrecord * r = claim_record(pos);
+    if (not_nullptr(r))
+    {
+        std::size_t length = 0;
+        for (int p = 0; p < count; ++p)
+        {
+            if (is_nullptr(parts[p]))
+                continue;
+
+            std::size_t n = std::strlen(parts[p]);
+            if (n > c_log_text_size - 1 - length)
+                n = c_log_text_size - 1 - length;
+
+            std::memcpy(&r->lr_text[length], parts[p], n);
+            length += n;
+        }
+        r->lr_text[length] = 0;
+        publish_record(r, pos, lev);
+    }
+    return true;
+}
+
+/**
+ *  Formats a message straight into a record of the ring for the writer
+ *  thread.  Longer messages are truncated.
+ *
+ * \param lev
+ *      The level of the message.
+ *
+ * \param fmt
+ *      The printf() format.
+ *
+ * \param args
+ *      The arguments of the format.  Not used if false is returned.
+ *
+ * \return
+ *      Returns false if the caller must write the message itself, as for
+ *      async_log().
+ */
+
+bool
+async_vlog (msglevel lev, const char * fmt, std::va_list args)
+{
+    if (! log_level(lev))
+        return true;                                /* level is turned off  */
+
+    logproducer producer;
+    if (! producer.active())
+        return false;
+
+    std::size_t pos;
+    logrecord * r = claim_record(pos);
+    if (not_nullptr(r))
+    {
+        if (std::vsnprintf(r->lr_text, c_log_text_size, fmt, args) < 0)
+            r->lr_text[0] = 0;
+
+        publish_record(r, pos, lev);
+    }
+    return true;
+}
+
+/**
+ *  Writes the filled records of the ring.  Called only by the writer thread,
+ *  or by async_log_stop() after that thread has ended.
+ *
+ * \return
+ *      Returns true if any record was written.
+ */
+
+static bool
+drain_ring ()
+{
+    bool result = false;
+    for (;;)
+    {
+        logrecord & r = s_ring[s_dequeue_pos & c_log_ring_mask];
+        std::size_t seq = r.lr_sequence.load(std::memory_order_acquire);
+        if (seq != s_dequeue_pos + 1)
+            break;
+
+        log_write(r.lr_level, std::string(r.lr_text));
+        r.lr_sequence.store
+        (
+            s_dequeue_pos + c_log_ring_size, std::memory_order_release
+        );
+        ++s_dequeue_pos;
+        result = true;
+    }
+
+    unsigned dropped = s_dropped.exchange(0);
+    if (dropped > 0)
+    {
+        std::string msg = std::to_string(dropped) + " log messages dropped";
+        log_write(msglevel::warn, msg);
+    }
+    return result;
+}
+
+static void
+writer_func ()
+{
+    while (! s_stopping)
+    {
+        if (! drain_ring())
+        {
+            std::this_thread::sleep_for
+            (
+                std::chrono::milliseconds(c_log_idle_ms)
+            );
+        }
+    }
+}
+
+/**
+ *  Starts the writer thread.  The calling thread becomes the "main" thread,
+ *  whose messages are written at once.
+ *
+ * \return
+ *      Returns true if the log was started, or was already running.
+ */
+
+bool
+async_log_start ()
+{
+    if (s_active)
+        return true;
+
+    for (std::size_t i = 0; i < c_log_ring_size; ++i)
+        s_ring[i].lr_sequence.store(i, std::memory_order_relaxed);
+
+    s_enqueue_pos = 0;
+    s_dequeue_pos = 0;
+    s_dropped = 0;
+    s_stopping = false;
+    s_main_thread = std::this_thread::get_id();
+    try
+    {
+        s_writer.lw_thread = std::thread(writer_func);
+        s_active = true;
+    }
+    catch (const std::system_error &)
+    {
+        s_active = false;
+    }
+    return s_active;
+}
+
+/**
+ *  Stops the writer thread, after it has written what it has.  First it
+ *  waits for the producers that got past the s_active check to finish
+ *  their records, then writes whatever was pushed meanwhile.  Then all
+ *  messages are written at once again.
+ */
+
+void
+async_log_stop ()
+{
+    if (s_active)
+    {
+        s_active = false;
+        while (s_producers > 0)
+            std::this_thread::yield();
+
+        s_stopping = true;
+        if (s_writer.lw_thread.joinable())
+            s_writer.lw_thread.join();
+
+        (void) drain_ring();
+    }
+}
+
+bool
+async_log_active ()
+{
+    return s_active;
+}
+
+/**
+ *  Queues the pieces of a message, or joins and writes them if the log is
+ *  not running or this is the main thread.  Drops them if the level is
+ *  turned off.
+ */
+
+void
+log_parts (msglevel lev, const char * const parts [], int count)
+{
+    if (! async_log(lev, parts, count))
+    {
+        std::string text;
+        for (int p = 0; p < count; ++p)
+        {
+            if (not_nullptr(parts[p]))
+                text += parts[p];
+        }
+        log_write(lev, text);
+    }
+}
+
+/**
+ *  The entry point for the message functions.  Joins a message and its
+ *  optional data as "msg: data", without building the text on the caller's
+ *  thread if it is queued.  Nothing is written if both are empty, or if the
+ *  level is turned off.
+ */
+
+void
+log_message (msglevel lev, const std::string & msg, const std::string & data)
+{
+    if (! log_level(lev))
+        return;
+
+    if (data.empty())
+    {
+        if (! msg.empty())
+        {
+            const char * parts [] = { msg.c_str() };
+            log_parts(lev, parts, 1);
+        }
+    }
+    else
+    {
+        const char * parts [] = { msg.c_str(), ": ", data.c_str() };
+        log_parts(lev, parts, 3);
+    }
+}
+
+}           // namespace seq66
+
+/*
+ * asynclog.cpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -37,6 +37,7 @@
 #include <cstdarg>                      /* see "man stdarg(3)"              */
 #include <iostream>
 
+#include "util/asynclog.hpp"            /* seq66::log_message()             */
 #include "util/basic_macros.hpp"        /* basic macros-cum-functions       */
 
 #if defined SEQ66_PLATFORM_UNIX
@@ -60,16 +61,22 @@ namespace seq66
 
 /**
  *  Functions to remove dependencies on the "cfg" modules. Could eventually
- *  replace rcsettings::verbose() and investigate().
+ *  replace rcsettings::verbose() and investigate().  They also turn the
+ *  matching message levels of the log on or off: verbose shows the info
+ *  messages, investigate the debug messages, and quiet hides the info,
+ *  status, and session messages, leaving only warnings and errors.  Quiet
+ *  wins over verbose, whichever is set first.
  */
 
 static bool s_is_verbose = false;
 static bool s_is_investigate = false;
+static bool s_is_quiet = false;
 
 void
 set_verbose (bool flag)
 {
     s_is_verbose = flag;
+    log_level(msglevel::info, flag && ! s_is_quiet);
 }
 
 bool
@@ -82,6 +89,7 @@ void
 set_investigate (bool flag)
 {
     s_is_investigate = flag;
+    log_level(msglevel::debug, flag);
 }
 
 bool
@@ -90,6 +98,21 @@ investigate ()
     return s_is_investigate;
 }
 
+void
+set_quiet (bool flag)
+{
+    s_is_quiet = flag;
+    log_level(msglevel::info, s_is_verbose && ! flag);
+    log_level(msglevel::status, ! flag);
+    log_level(msglevel::session, ! flag);
+}
+
+bool
+quiet ()
+{
+    return s_is_quiet;
+}
+
 /**
  *  Provides a way to still get the benefits of assert() output in release
  *  mode, without aborting the application.
@@ -265,7 +288,10 @@ async_safe_utoa (char * destination, unsigned number, bool spacebefore)
 
 /**
  *  Common-code for console informationational messages.  Adds markers and a
- *  newline.
+ *  newline.  This and the other message functions hand the text to
+ *  log_message(), which filters it by level and writes it, or queues it if
+ *  called from a realtime thread.  The info level is on only in verbose
+ *  mode, unless log_level() turns it on at run-time.
  *
  * \param msg
  *      The message to print, sans the newline.
@@ -281,41 +307,21 @@ async_safe_utoa (char * destination, unsigned number, bool spacebefore)
 bool
 info_message (const std::string & msg, const std::string & data)
 {
-    if (verbose())
-    {
-        std::cout << seq_client_tag(msglevel::info) << " " << msg;
-        if (! data.empty())
-            std::cout << ": " << data;
-
-        if (! msg.empty())
-            std::cout << std::endl;
-    }
+    log_message(msglevel::info, msg, data);
     return true;
 }
 
 bool
 status_message (const std::string & msg, const std::string & data)
 {
-    std::cout << seq_client_tag(msglevel::status) << " " << msg;
-    if (! data.empty())
-        std::cout << ": " << data;
-
-    if (! msg.empty())
-        std::cout << std::endl;
-
+    log_message(msglevel::status, msg, data);
     return true;
 }
 
 bool
 session_message (const std::string & msg, const std::string & data)
 {
-    std::cout << seq_client_tag(msglevel::session) << " " << msg;
-    if (! data.empty())
-        std::cout << ": " << data;
-
-    if (! msg.empty())
-        std::cout << std::endl;
-
+    log_message(msglevel::session, msg, data);
     return true;
 }
 
@@ -336,13 +342,7 @@ session_message (const std::string & msg, const std::string & data)
 bool
 warn_message (const std::string & msg, const std::string & data)
 {
-    std::cerr << seq_client_tag(msglevel::warn) << " " << msg;
-    if (! data.empty())
-        std::cerr << ": " << data;
-
-    if (! msg.empty())
-        std::cerr << std::endl;
-
+    log_message(msglevel::warn, msg, data);
     return true;
 }
 
@@ -363,23 +363,10 @@ warn_message (const std::string & msg, const std::string & data)
 bool
 error_message (const std::string & msg, const std::string & data)
 {
-    std::cerr << seq_client_tag(msglevel::error) << " " << msg;
-    if (! data.empty())
-        std::cerr << ": " << data;
-
-    if (! msg.empty())
-        std::cerr << std::endl;
-
+    log_message(msglevel::error, msg, data);
     return false;
 }
 
-/**
- *  More sneaky escape sequences for coloring.
- */
-
-static const char * s_black  = "\033[1;30m";
-static const char * s_normal = "\033[0m";
-
 /**
  *  Common-code for debug messages.  Adds markers, and returns false.
  *
@@ -396,24 +383,7 @@ static const char * s_normal = "\033[0m";
 bool
 debug_message (const std::string & msg, const std::string & data)
 {
-    if (investigate())
-    {
-        std::cerr << seq_client_tag(msglevel::debug) << " ";
-        if (is_a_tty(STDERR_FILENO))
-            std::cerr << s_black;
-
-        std::cerr << msg;
-        if (! data.empty())
-            std::cerr << ": " << data;
-
-        if (! msg.empty())
-        {
-            if (is_a_tty(STDERR_FILENO))
-                std::cerr << s_normal << std::endl;
-            else
-                std::cerr << std::endl;
-        }
-    }
+    log_message(msglevel::debug, msg, data);
     return true;
 }
 
@@ -435,9 +405,8 @@ debug_message (const std::string & msg, const std::string & data)
 bool
 file_error (const std::string & tag, const std::string & path)
 {
-    std::cerr << seq_client_tag(msglevel::error) << " "
-        << tag << ": '" << path << "'" << std::endl;
-
+    const char * parts [] = { tag.c_str(), ": '", path.c_str(), "'" };
+    log_parts(msglevel::error, parts, 4);
     return false;
 }
 
@@ -456,8 +425,8 @@ file_error (const std::string & tag, const std::string & path)
 void
 file_message (const std::string & tag, const std::string & path)
 {
-    std::cout << seq_client_tag(msglevel::status) << " "
-        << tag << ": '" << path << "'" << std::endl;
+    const char * parts [] = { tag.c_str(), ": '", path.c_str(), "'" };
+    log_parts(msglevel::status, parts, 4);
 }
 
 /**
@@ -595,33 +564,9 @@ msgprintf (msglevel lev, std::string fmt, ...)
         va_list args;                                       /* Step 1       */
         va_start(args, fmt);
 
-        std::string output = formatted(fmt, args);          /* Steps 2 & 3  */
-        switch (lev)
-        {
-        case msglevel::none:
-
-            std::cout << seq_client_tag(lev) << " " << output << std::endl;
-            break;
-
-        case msglevel::info:
-
-            if (verbose())
-                std::cout << seq_client_tag(lev) << " " << output << std::endl;
-            break;
+        if (! async_vlog(lev, fmt.c_str(), args))           /* into a ring  */
+            log_write(lev, formatted(fmt, args));           /* Steps 2 & 3  */
 
-        case msglevel::status:
-        case msglevel::session:
-
-            std::cout << seq_client_tag(lev) << " " << output << std::endl;
-            break;
-
-        case msglevel::warn:
-        case msglevel::error:
-        case msglevel::debug:
-
-            std::cerr << seq_client_tag(lev) << " " << output << std::endl;
-            break;
-        }
         va_end(args);                                       /* 2019-04-21   */
     }
 }
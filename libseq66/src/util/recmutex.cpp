@@ -30,11 +30,30 @@
  *  Seq66 needs a mutex for sequencer operations. We have finally, after a
  *  week of monkeying around with std::condition_variable, which requires
  *  std::mutex, decided to stick with the old pthreads implementation for now.
+ *
+ *  The lock profile (SEQ66_LOCK_PROFILE) tries the lock first.  Only if that
+ *  fails is the wait timed, so an uncontended lock() costs a trylock and a
+ *  few relaxed atomic operations.  The statistics are updated while the lock
+ *  is held, so they need no lock of their own.
  */
 
-#include "seq66_platform_macros.h"      /* pick the compiler and platform   */
+#include "seq66_features.h"            /* SEQ66_LOCK_PROFILE, platform     */
 #include "util/recmutex.hpp"            /* seq66::recmutex                  */
 
+#if defined SEQ66_LOCK_PROFILE
+#include <algorithm>                    /* std::sort()                      */
+#include <atomic>                       /* std::atomic<>                    */
+#include <chrono>                       /* std::chrono::steady_clock        */
+#include <cstdint>                      /* std::int64_t                     */
+#include <cstdio>                       /* std::snprintf(), std::fputs()    */
+#include <map>                          /* std::map<>                       */
+#include <mutex>                        /* std::mutex, std::lock_guard      */
+#include <new>                          /* std::nothrow                     */
+#include <vector>                       /* std::vector<>                    */
+
+#include "util/basic_macros.h"          /* not_nullptr() macro              */
+#endif
+
 /**
  *  The MingW compiler (at least on Windows) and the Microsoft Visual Studio
  *  compiler do not support the pthread PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
@@ -76,23 +95,411 @@ recmutex::init_global_mutex ()
     }
 }
 
+#if defined SEQ66_LOCK_PROFILE
+
+/**
+ *  The statistics of one mutex.  Times are in nanoseconds.  Threads are
+ *  numbered from 1 in the order in which they first lock a profiled mutex;
+ *  0 means none.
+ */
+
+struct lockstats
+{
+    std::string ls_name;                            /**< Name of the mutex. */
+    int ls_instance;                                /**< Nth, -1 if gone.   */
+    std::size_t ls_slot;                            /**< Index in registry. */
+    std::atomic<unsigned long> ls_acquisitions;     /**< Times locked.      */
+    std::atomic<unsigned long> ls_contended;        /**< Times waited.      */
+    std::atomic<std::int64_t> ls_wait_ns;           /**< Total wait.        */
+    std::atomic<std::int64_t> ls_max_wait_ns;       /**< Longest wait.      */
+    std::atomic<int> ls_max_waiter;                 /**< Who waited longest */
+    std::atomic<int> ls_max_holder;                 /**< ... behind whom.   */
+    std::atomic<int> ls_holder;                     /**< Current holder.    */
+    int ls_depth;                                   /**< Recursion depth.   */
+};
+
+/**
+ *  Holds the statistics of all of the profiled mutexes.  When a mutex is
+ *  destroyed, its figures are added to the entry of destroyed mutexes of
+ *  the same name, and its own entry goes to a free list for reuse.  The
+ *  entries are never deleted, so a report can be made at any time.  When
+ *  the registry is destroyed at exit, it writes the report to the console.
+ */
+
+class lockregistry
+{
+
+public:
+
+    std::mutex lr_mutex;
+    std::vector<lockstats *> lr_stats;              /* live mutexes         */
+    std::vector<lockstats *> lr_free;               /* entries for reuse    */
+    std::map<std::string, int> lr_instances;        /* count per name       */
+    std::map<std::string, lockstats *> lr_retired;  /* destroyed, per name  */
+
+    lockregistry ();
+    ~lockregistry ();
+
+};
+
+/**
+ *  Set while the registry exists.  A mutex destroyed after the registry,
+ *  at exit, must not touch it.
+ */
+
+static std::atomic<bool> s_registry_alive(false);
+
+lockregistry::lockregistry () :
+    lr_mutex        (),
+    lr_stats        (),
+    lr_free         (),
+    lr_instances    (),
+    lr_retired      ()
+{
+    s_registry_alive = true;
+}
+
+static std::string make_report (lockregistry & reg, int topcount);
+
+lockregistry::~lockregistry ()
+{
+    std::string report = make_report(*this, 10);
+    s_registry_alive = false;
+    if (! report.empty())
+    {
+        report += "\n";
+        (void) std::fputs(report.c_str(), stderr);
+    }
+}
+
+/**
+ *  The registry is created on first use, since mutexes are constructed
+ *  during static initialization as well.
+ */
+
+static lockregistry &
+lock_registry ()
+{
+    static lockregistry s_registry;
+    return s_registry;
+}
+
+/**
+ *  Provides the number of the calling thread.  See lockstats.
+ */
+
+static int
+thread_number ()
+{
+    static std::atomic<int> s_thread_count(0);
+    static thread_local int t_thread_number = 0;
+    if (t_thread_number == 0)
+        t_thread_number = ++s_thread_count;
+
+    return t_thread_number;
+}
+
+static std::int64_t
+profile_now_ns ()
+{
+    using namespace std::chrono;
+    auto t = steady_clock::now().time_since_epoch();
+    return std::int64_t(duration_cast<nanoseconds>(t).count());
+}
+
+/**
+ *  Zeroes the statistics of an entry.
+ *
+ * \param ls
+ *      The entry.
+ *
+ * \param all
+ *      If true, the holder and recursion depth are zeroed as well.  They
+ *      describe a lock now held, so are kept by profile_clear().
+ */
+
+static void
+reset_stats (lockstats & ls, bool all)
+{
+    ls.ls_acquisitions.store(0, std::memory_order_relaxed);
+    ls.ls_contended.store(0, std::memory_order_relaxed);
+    ls.ls_wait_ns.store(0, std::memory_order_relaxed);
+    ls.ls_max_wait_ns.store(0, std::memory_order_relaxed);
+    ls.ls_max_waiter.store(0, std::memory_order_relaxed);
+    ls.ls_max_holder.store(0, std::memory_order_relaxed);
+    if (all)
+    {
+        ls.ls_holder.store(0, std::memory_order_relaxed);
+        ls.ls_depth = 0;
+    }
+}
+
+/**
+ *  Adds a mutex to the registry, reusing a free entry if there is one.
+ *
+ * \param name
+ *      The name of the mutex, or null for an unnamed one.
+ */
+
+static lockstats *
+register_lock (const char * name)
+{
+    lockregistry & reg = lock_registry();
+    std::lock_guard<std::mutex> guard(reg.lr_mutex);
+    lockstats * result = nullptr;
+    if (reg.lr_free.empty())
+        result = new (std::nothrow) lockstats;
+    else
+    {
+        result = reg.lr_free.back();
+        reg.lr_free.pop_back();
+    }
+    if (not_nullptr(result))
+    {
+        result->ls_name = not_nullptr(name) ? name : "unnamed";
+        result->ls_instance = reg.lr_instances[result->ls_name]++;
+        result->ls_slot = reg.lr_stats.size();
+        reset_stats(*result, true);
+        reg.lr_stats.push_back(result);
+    }
+    return result;
+}
+
+/**
+ *  Adds the figures of a destroyed mutex to the entry of destroyed mutexes
+ *  with its name, then removes its entry from the live list and frees it
+ *  for reuse.
+ *
+ * \param ls
+ *      The entry of the destroyed mutex.
+ */
+
+static void
+release_lock (lockstats * ls)
+{
+    if (is_nullptr(ls) || ! s_registry_alive)
+        return;
+
+    lockregistry & reg = lock_registry();
+    std::lock_guard<std::mutex> guard(reg.lr_mutex);
+    lockstats *& gone = reg.lr_retired[ls->ls_name];
+    if (is_nullptr(gone))
+    {
+        gone = new (std::nothrow) lockstats;
+        if (not_nullptr(gone))
+        {
+            gone->ls_name = ls->ls_name;
+            gone->ls_instance = -1;
+            gone->ls_slot = 0;
+            reset_stats(*gone, true);
+        }
+    }
+    if (not_nullptr(gone))
+    {
+        auto relaxed = std::memory_order_relaxed;
+        gone->ls_acquisitions += ls->ls_acquisitions.load(relaxed);
+        gone->ls_contended += ls->ls_contended.load(relaxed);
+        gone->ls_wait_ns += ls->ls_wait_ns.load(relaxed);
+        std::int64_t maxwait = ls->ls_max_wait_ns.load(relaxed);
+        if (maxwait > gone->ls_max_wait_ns.load(relaxed))
+        {
+            gone->ls_max_wait_ns.store(maxwait);
+            gone->ls_max_waiter.store(ls->ls_max_waiter.load(relaxed));
+            gone->ls_max_holder.store(ls->ls_max_holder.load(relaxed));
+        }
+    }
+
+    lockstats * last = reg.lr_stats.back();         /* swap with the last   */
+    last->ls_slot = ls->ls_slot;
+    reg.lr_stats[ls->ls_slot] = last;
+    reg.lr_stats.pop_back();
+    reg.lr_free.push_back(ls);
+}
+
+/**
+ *  Makes the lock-profile report.  See recmutex::profile_report().  The
+ *  registry lock is held throughout, so that no entry is reused while it
+ *  is read.
+ *
+ * \param reg
+ *      The registry, passed in so that its destructor can report.
+ *
+ * \param topcount
+ *      The number of mutexes to list.
+ *
+ * \return
+ *      Returns lines of text, without a trailing newline.
+ */
+
+static std::string
+make_report (lockregistry & reg, int topcount)
+{
+    auto relaxed = std::memory_order_relaxed;
+    std::lock_guard<std::mutex> guard(reg.lr_mutex);
+    std::vector<const lockstats *> worst;
+    unsigned long mutexes = (unsigned long)(reg.lr_stats.size());
+    unsigned long acquisitions = 0;
+    unsigned long contended = 0;
+    auto tally = [&] (const lockstats * ls)
+    {
+        acquisitions += ls->ls_acquisitions.load(relaxed);
+        if (ls->ls_contended.load(relaxed) > 0)
+        {
+            contended += ls->ls_contended.load(relaxed);
+            worst.push_back(ls);
+        }
+    };
+    for (const auto ls : reg.lr_stats)
+        tally(ls);
+
+    for (const auto & r : reg.lr_retired)
+        tally(r.second);
+
+    std::sort
+    (
+        worst.begin(), worst.end(),
+        [] (const lockstats * a, const lockstats * b)
+        {
+            return a->ls_wait_ns.load(std::memory_order_relaxed) >
+                b->ls_wait_ns.load(std::memory_order_relaxed);
+        }
+    );
+    if (int(worst.size()) > topcount)
+        worst.resize(size_t(topcount));
+
+    char temp[192];
+    (void) snprintf
+    (
+        temp, sizeof temp,
+        "Lock profile: %lu mutexes, %lu acquisitions, %lu contended",
+        mutexes, acquisitions, contended
+    );
+
+    std::string result = temp;
+    for (const auto ls : worst)
+    {
+        char which[16];
+        if (ls->ls_instance >= 0)
+            (void) snprintf(which, sizeof which, "#%d", ls->ls_instance);
+        else
+            (void) snprintf(which, sizeof which, "(destroyed)");
+
+        (void) snprintf
+        (
+            temp, sizeof temp,
+            "\n  %s %s: %lu of %lu contended, wait %lld us, "
+            "max %lld us (thread %d behind thread %d)",
+            ls->ls_name.c_str(), which,
+            ls->ls_contended.load(relaxed),
+            ls->ls_acquisitions.load(relaxed),
+            (long long)(ls->ls_wait_ns.load(relaxed) / 1000),
+            (long long)(ls->ls_max_wait_ns.load(relaxed) / 1000),
+            ls->ls_max_waiter.load(relaxed),
+            ls->ls_max_holder.load(relaxed)
+        );
+        result += temp;
+    }
+    return result;
+}
+
+#endif  // defined SEQ66_LOCK_PROFILE
+
 /**
  *  Constructor for recmutex.
+ *
+ * \param name
+ *      Names the mutex in the lock-profile report.  Ignored unless
+ *      SEQ66_LOCK_PROFILE is defined.  The default is null.
  */
 
-recmutex::recmutex () : m_mutex_lock () /* uninitialized pthread_mutex_t    */
+recmutex::recmutex (const char * name) :
+    m_mutex_lock    (),                 /* uninitialized pthread_mutex_t    */
+    m_stats         (nullptr)
 {
     init_global_mutex();                /* might not need global mutex, tho */
     m_mutex_lock = MUTEX_INITIALIZER;
+#if defined SEQ66_LOCK_PROFILE
+    m_stats = register_lock(name);
+#else
+    (void) name;
+#endif
+}
+
+/**
+ *  Hands the lock statistics, if any, back to the profile registry.
+ */
+
+recmutex::~recmutex ()
+{
+#if defined SEQ66_LOCK_PROFILE
+    release_lock(m_stats);
+#endif
+}
+
+/**
+ *  Move constructor.  The native mutex is copied, as the defaulted move
+ *  did; the lock statistics are taken over, so that only one of the two
+ *  objects hands them back.
+ */
+
+recmutex::recmutex (recmutex && rhs) :
+    m_mutex_lock    (rhs.m_mutex_lock),
+    m_stats         (rhs.m_stats)
+{
+    rhs.m_stats = nullptr;
+}
+
+recmutex &
+recmutex::operator = (recmutex && rhs)
+{
+    if (this != &rhs)
+    {
+#if defined SEQ66_LOCK_PROFILE
+        release_lock(m_stats);
+#endif
+        m_mutex_lock = rhs.m_mutex_lock;
+        m_stats = rhs.m_stats;
+        rhs.m_stats = nullptr;
+    }
+    return *this;
 }
 
 /**
- *  Locks the recmutex.
+ *  Locks the recmutex.  When profiling, a failed trylock means another
+ *  thread holds the lock, and the wait for it is timed.
  */
 
 void
 recmutex::lock () const
 {
+#if defined SEQ66_LOCK_PROFILE
+    if (not_nullptr(m_stats))
+    {
+        int me = thread_number();
+        if (pthread_mutex_trylock(&m_mutex_lock) != 0)
+        {
+            int holder = m_stats->ls_holder.load(std::memory_order_relaxed);
+            std::int64_t start = profile_now_ns();
+            pthread_mutex_lock(&m_mutex_lock);
+
+            std::int64_t wait = profile_now_ns() - start;
+            auto & st = *m_stats;
+            (void) st.ls_contended.fetch_add(1, std::memory_order_relaxed);
+            (void) st.ls_wait_ns.fetch_add(wait, std::memory_order_relaxed);
+            if (wait > st.ls_max_wait_ns.load(std::memory_order_relaxed))
+            {
+                st.ls_max_wait_ns.store(wait, std::memory_order_relaxed);
+                st.ls_max_waiter.store(me, std::memory_order_relaxed);
+                st.ls_max_holder.store(holder, std::memory_order_relaxed);
+            }
+        }
+        (void) m_stats->ls_acquisitions.fetch_add(1, std::memory_order_relaxed);
+        if (m_stats->ls_depth++ == 0)
+            m_stats->ls_holder.store(me, std::memory_order_relaxed);
+
+        return;
+    }
+#endif
     pthread_mutex_lock(&m_mutex_lock);
 }
 
@@ -103,9 +510,73 @@ recmutex::lock () const
 void
 recmutex::unlock () const
 {
+#if defined SEQ66_LOCK_PROFILE
+    if (not_nullptr(m_stats) && m_stats->ls_depth > 0)
+    {
+        if (--m_stats->ls_depth == 0)
+            m_stats->ls_holder.store(0, std::memory_order_relaxed);
+    }
+#endif
     pthread_mutex_unlock(&m_mutex_lock);
 }
 
+/**
+ *  Indicates if lock profiling is built in.
+ */
+
+bool
+recmutex::profiling ()
+{
+#if defined SEQ66_LOCK_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ *  Makes a report of the mutexes that have waited the longest in total.
+ *  Mutexes that have never been contended are left out.
+ *
+ * \param topcount
+ *      The number of mutexes to list.
+ *
+ * \return
+ *      Returns lines of text, without a trailing newline.  Empty if lock
+ *      profiling is not built in.
+ */
+
+std::string
+recmutex::profile_report (int topcount)
+{
+#if defined SEQ66_LOCK_PROFILE
+    return make_report(lock_registry(), topcount);
+#else
+    (void) topcount;
+    return std::string();
+#endif
+}
+
+/**
+ *  Zeroes the statistics of all mutexes, including those destroyed.  The
+ *  holders and recursion depths are left alone, as they describe the locks
+ *  now held.
+ */
+
+void
+recmutex::profile_clear ()
+{
+#if defined SEQ66_LOCK_PROFILE
+    lockregistry & reg = lock_registry();
+    std::lock_guard<std::mutex> guard(reg.lr_mutex);
+    for (auto ls : reg.lr_stats)
+        reset_stats(*ls, false);
+
+    for (auto & r : reg.lr_retired)
+        reset_stats(*r.second, false);
+#endif
+}
+
 }           // namespace seq66
 
 /*
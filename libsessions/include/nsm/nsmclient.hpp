@@ -99,6 +99,7 @@ public:
     virtual ~nsmclient ();
 
     void send_visibility (bool isshown);
+    bool send_status (int priority, const std::string & mesg);
 
     bool hidden () const
     {
@@ -566,6 +566,26 @@ nsmclient::send_visibility (bool isshown)
     send_from_client(status);
 }
 
+/**
+ *  Sends a status message, which the session manager shows for this client.
+ *  See nsmbase::message().
+ *
+ * \param priority
+ *      Ranges from 0 (least important) to 3 (most important).
+ *
+ * \param mesg
+ *      The text to show.
+ *
+ * \return
+ *      Returns true if the message could be sent.
+ */
+
+bool
+nsmclient::send_status (int priority, const std::string & mesg)
+{
+    return message(priority, mesg);
+}
+
 /**
  *  Receives a broadcast and figures out what to do with it.  Sort of.  The
  *  broadcast message seems to have no path and no data types.  Keep an eye on
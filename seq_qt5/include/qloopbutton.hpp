@@ -33,7 +33,13 @@
  *
  */
 
+#include <map>                          /* std::map<> thumbnail cache       */
+#include <memory>                       /* std::weak_ptr<>                  */
+#include <tuple>                        /* std::tuple<> thumbnail key       */
+
 #include <QFont>
+#include <QPen>
+#include <QPixmap>
 
 #include "qslotbutton.hpp"              /* seq66::qslotbutton base class    */
 
@@ -112,6 +118,46 @@ public:
 
 private:
 
+    /**
+     *  A rendering of the notes (or the fingerprint) of a pattern, covering
+     *  the progress box of a button.  The pixmap is transparent outside of
+     *  the notes, so that it can be drawn over the progress box, whose
+     *  background shows the armed/queued status.  It is valid as long as the
+     *  sequence lives and its edit generation, color, and transposability
+     *  are unchanged.
+     */
+
+    class thumbnail
+    {
+        friend class qloopbutton;
+
+    private:
+
+        std::weak_ptr<sequence> m_owner;
+        unsigned m_generation;
+        int m_color;
+        bool m_transposable;
+        QPixmap m_pixmap;
+
+    public:
+
+        thumbnail ();
+
+    };          // nested class thumbnail
+
+    /**
+     *  The thumbnails are shared by all buttons (e.g. of the main live grid
+     *  and of external live frames) showing the same pattern at the same
+     *  button size.  The key is the sequence plus the button width and
+     *  height.
+     */
+
+    using thumbkey = std::tuple<const sequence *, int, int>;
+    using thumbmap = std::map<thumbkey, thumbnail>;
+
+    static thumbmap sm_thumbnails;
+    static const std::size_t sm_thumbnail_limit;
+
     /**
      *  Allows for tailorable progress-box sizes as a percentage of the button
      *  size.
@@ -190,10 +236,25 @@ private:
     Color m_prog_fore_color;
 
     /**
-     *  The font for drawing text.
+     *  The fonts for drawing text and the record annunciator, made once
+     *  rather than in every paint.
      */
 
     QFont m_text_font;
+    QFont m_record_font;
+
+    /**
+     *  The pen for the progress bar, made once rather than in every paint.
+     */
+
+    QPen m_progress_pen;
+
+    /**
+     *  Holds the label_stamp() value of the last full repaint.  While it is
+     *  unchanged, refresh() repaints only the progress box.
+     */
+
+    unsigned long m_label_stamp;
 
     /**
      *  Text and progress-box support members.
@@ -241,7 +302,15 @@ public:
     }
 
     virtual void setup () override;
+    virtual bool rebind
+    (
+        seq::number slotnumber,
+        const std::string & label,
+        const std::string & hotkey,
+        seq::pointer seqp
+    ) override;
     virtual void reupdate (bool all = true) override;
+    virtual void refresh () override;
     virtual void set_checked (bool flag) override;
     virtual bool toggle_enabled () override;
     virtual bool toggle_checked () override;
@@ -252,6 +321,9 @@ protected:
     void draw_progress_box (QPainter & painter);
     void draw_pattern (QPainter & painter);
     void initialize_fingerprint ();
+    const QPixmap & pattern_thumbnail ();
+    unsigned long label_stamp () const;
+    void set_loop_colors ();
 
 private:
 
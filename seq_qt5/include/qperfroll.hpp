@@ -35,6 +35,11 @@
  *  performance/song editor.
  */
 
+#include <map>                          /* std::map<> of cached tiles       */
+#include <utility>                      /* std::pair<> tile key and stamp   */
+#include <vector>                       /* std::vector<> of track stamps    */
+
+#include <QPixmap>                      /* cached tile of the song grid     */
 #include <QWidget>
 
 #include "qperfbase.hpp"                /* seq66::qperfbase base class      */
@@ -56,6 +61,7 @@ namespace seq66
     class performer;
     class qperfeditframe64;
     class qperfnames;
+    class sequence;
 
 /**
  * The grid in the song editor for setting out sequences
@@ -92,12 +98,70 @@ public:
     bool v_zoom_out ();
     bool reset_v_zoom ();
 
+private:
+
+    /**
+     *  Identifies what was drawn for a track: the sequence object, and a
+     *  value combining its edit generation, color, and armed status.
+     */
+
+    using stamp = std::pair<const sequence *, unsigned long>;
+
+    /**
+     *  A cached rendering of the grid and triggers for a rectangle of the
+     *  song editor.  Each tile covers a fixed number of pixels (i.e. a tick
+     *  range at the current zoom) and a fixed number of tracks.  The stamps
+     *  are the track_stamp() values of those tracks when the tile was drawn.
+     */
+
+    class tile
+    {
+    public:
+
+        QPixmap t_pixmap;
+        std::vector<stamp> t_stamps;
+    };
+
+    /**
+     *  The notes of a track and their range, as drawn in its trigger boxes.
+     *  The stamp holds the sequence and its edit generation when the notes
+     *  were fetched, so that redrawing a tile fetches them only if the
+     *  pattern has changed.
+     */
+
+    class trackcache
+    {
+    public:
+
+        stamp tc_stamp;
+        int tc_note_min;
+        int tc_note_max;
+        sequence::notelist tc_notes;
+    };
+
+    using trackcachemap = std::map<int, trackcache>;
+
+    /**
+     *  Tiles are keyed by (column, row) of the tile grid.
+     */
+
+    using tilekey = std::pair<int, int>;
+    using tilemap = std::map<tilekey, tile>;
+
 private:
 
     bool in_selection_area (midipulse tick);
     bool move_by_key (bool forward, bool single = true);
     void draw_grid (QPainter & painter, const QRect & r);
     void draw_triggers (QPainter & painter, const QRect & r);
+    QRect tile_rect (int column, int row) const;
+    stamp track_stamp (int seqid) const;
+    const trackcache & track_notes (int seqid, sequence & s);
+    bool tile_current (const tile & t, int row) const;
+    bool tiles_current (const QRect & area) const;
+    void check_tile_layout ();
+    void render_tile (tile & t, int column, int row);
+    void update_progress ();
 
     void resize ()
     {
@@ -184,6 +248,33 @@ private:
     bool m_grow_direction;
     bool m_adding_pressed;
 
+    /**
+     *  The cached tiles of the grid and triggers.  The paintEvent() copies
+     *  the tiles that intersect the damaged area, redrawing only those whose
+     *  tracks have changed.  The playhead and the selection box are drawn on
+     *  top of the tiles.
+     */
+
+    tilemap m_tiles;
+
+    /**
+     *  The layout values in force when the tiles were drawn.  If any of them
+     *  changes (zoom, track height, guides, widget size), all tiles are
+     *  dropped.
+     */
+
+    int m_tile_zoom;
+    int m_tile_track_height;
+    midipulse m_tile_beat;
+    midipulse m_tile_measure;
+    QSize m_tile_size;
+
+    /**
+     *  The notes of each track, keyed by track number; see track_notes().
+     */
+
+    trackcachemap m_track_cache;
+
 };          // class qperfroll
 
 }           // namespace seq66
@@ -37,6 +37,7 @@
  *  progress bar during playback.  See the qseqbase::m_progress_follow member.
  */
 
+#include <QPixmap>                      /* cached grid & notes layer        */
 #include <QWidget>
 
 #include "cfg/scales.hpp"               /* seq66::scales enum class         */
@@ -48,7 +49,6 @@
  */
 
 class QMessageBox;
-class QPixmap;
 class QTimer;
 
 /*
@@ -104,6 +104,18 @@ public:
         return m_backseq_color;
     }
 
+    /**
+     *  Besides flagging a repaint, any change that calls set_dirty() (zoom,
+     *  scale, key, edits made via this roll) forces the backing pixmap to be
+     *  rebuilt.  To repaint only the overlays, call qseqbase::set_dirty().
+     */
+
+    virtual void set_dirty () override
+    {
+        qseqbase::set_dirty();
+        m_backing_stale = true;
+    }
+
 private:
 
     virtual void scroll_offset (int v) override;
@@ -173,6 +185,10 @@ private:
     void draw_drum_notes (QPainter & painter, const QRect & r, bool background);
     void draw_drum_note (QPainter & painter, int x, int y);
     void call_draw_notes (QPainter & painter, const QRect & view);
+    void visible_notes (const QRect & r, int & note_l, int & note_h);
+    bool backing_stale () const;
+    void render_backing (const QRect & area);
+    void update_progress ();
 #if defined SEQ66_SHOW_TEMPO_IN_PIANO_ROLL
     void draw_tempo (QPainter & painter, int x, int y, int velocity);
 #endif
@@ -329,6 +345,38 @@ private:
 
     bool m_link_wraparound;
 
+    /**
+     *  Holds the grid and the notes, as drawn for the visible area
+     *  m_backing_rect.  The paintEvent() copies the damaged part of this
+     *  pixmap to the window, then draws the playhead and selection boxes on
+     *  top of it.  Thus moving the playhead does not require walking through
+     *  the events of the sequence.
+     */
+
+    QPixmap m_backing;
+
+    /**
+     *  The area of the widget, in widget coordinates, covered by m_backing.
+     *  A change in this area (scrolling or resizing) forces a rebuild.
+     */
+
+    QRect m_backing_rect;
+
+    /**
+     *  The values of sequence::edit_generation(), for the edited sequence and
+     *  the background sequence, at the time m_backing was drawn.
+     */
+
+    unsigned m_backing_generation;
+    unsigned m_backing_bg_generation;
+
+    /**
+     *  Set by set_dirty() to force a rebuild of m_backing even if the
+     *  sequence has not changed (e.g. zoom or a change of the scale).
+     */
+
+    bool m_backing_stale;
+
 signals:
 
 public slots:
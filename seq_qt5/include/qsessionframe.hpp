@@ -35,6 +35,8 @@
 
 #include <QFrame>
 
+class QTimer;
+
 /*
  * This is necessary to keep the compiler from thinking Ui::qsessionframe
  * would be found in the seq66 namespace.
@@ -105,6 +107,8 @@ private slots:
     void slot_flag_reload ();
     void slot_macros_active ();
     void slot_macro_pick (const QString &);
+    void slot_update_stats ();
+    void slot_reset_stats ();
 
 private:
 
@@ -120,6 +124,12 @@ private:
 
     performer & m_performer;
 
+    /**
+     *  A timer for refreshing the playback statistics.
+     */
+
+    QTimer * m_timer;
+
 };
 
 }               // namespace seq66
@@ -160,6 +160,7 @@ private:
     bool delete_slot (seq::number seqno);
     bool delete_all_slots ();
     bool recreate_all_slots ();
+    bool rebind_all_slots ();
     bool refresh_all_slots ();
     bool modify_slot (qslotbutton * newslot, int row, int column);
     void button_toggle_enabled (seq::number seqno);
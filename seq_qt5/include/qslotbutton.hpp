@@ -168,6 +168,13 @@ public:
     }
 
     virtual void setup ();
+    virtual bool rebind
+    (
+        seq::number slotnumber,
+        const std::string & label,
+        const std::string & hotkey,
+        seq::pointer seqp
+    );
 
     virtual seq::pointer loop ()
     {
@@ -309,6 +316,16 @@ protected:
         // no code, handles empty button
     }
 
+    /**
+     *  Called by the live grid's timer.  A derived class can repaint only
+     *  what has changed since the last call.
+     */
+
+    virtual void refresh ()
+    {
+        reupdate(true);
+    }
+
 protected:
 
     void label_color (Color c)
@@ -94,6 +94,11 @@ public:
         const std::string & msg
     ) const override;
     virtual bool run () override;
+    virtual void log_to_session
+    (
+        msglevel lev,
+        const std::string & text
+    ) override;
     virtual void session_manager_name (const std::string & mgrname) override;
     virtual void session_manager_path (const std::string & pathname) override;
     virtual void session_display_name (const std::string & dispname) override;
@@ -112,9 +117,12 @@ private:
 
 signals:                                /* from session client callbacks    */
 
+    void signal_log_message (const QString & text);
+
 private slots:
 
     void conditional_update ();         /* timer poll for dirty/clean       */
+    void show_log_message (const QString & text);
 
 private:
 
@@ -126,6 +126,24 @@ qloopbutton::progbox::progbox () :
     // no code
 }
 
+qloopbutton::thumbnail::thumbnail () :
+    m_owner         (),
+    m_generation    (0),
+    m_color         (0),
+    m_transposable  (false),
+    m_pixmap        ()
+{
+    // no code
+}
+
+/**
+ *  The shared pattern thumbnails.  If there are more than the limit (e.g.
+ *  after many resizings of the live grid), the whole cache is dropped.
+ */
+
+qloopbutton::thumbmap qloopbutton::sm_thumbnails;
+const std::size_t qloopbutton::sm_thumbnail_limit = 1024;
+
 /**
  *  Progress-box values.
  */
@@ -182,6 +200,9 @@ qloopbutton::qloopbutton
     m_prog_back_color       (Qt::black),
     m_prog_fore_color       (Qt::green),
     m_text_font             (),
+    m_record_font           (),
+    m_progress_pen          (progress_color()),
+    m_label_stamp           (0),
     m_text_initialized      (false),
     m_draw_text             (true),
     m_draw_background       (true),
@@ -196,15 +217,30 @@ qloopbutton::qloopbutton
     sm_draw_progress_box = usr().progress_box_shown();
     m_text_font.setBold(usr().progress_bar_thick());
     m_text_font.setLetterSpacing(QFont::AbsoluteSpacing, 1);
+    m_record_font.setPointSize(usr().scale_font_size(s_fontsize_record));
+    m_record_font.setBold(true);
+    m_progress_pen.setWidth(m_prog_thickness);
+    m_progress_pen.setStyle(Qt::SolidLine);
     make_active();
     make_checkable();
     set_checked(m_is_checked);
     text_color(foreground_paint());
+    set_loop_colors();
+}
+
+/**
+ *  Sets the pen and background colors from the color of the pattern.
+ */
 
+void
+qloopbutton::set_loop_colors ()
+{
     int c = loop() ? loop()->color() : palette_to_int(none) ;
     pen_color(get_pen_color(PaletteColor(c)));
     if (c != palette_to_int(black))
         back_color(get_color_fix(PaletteColor(c)));
+    else
+        back_color(background_paint());
 }
 
 /**
@@ -430,6 +466,67 @@ qloopbutton::initialize_fingerprint ()
     m_fingerprint_inited = true;
 }
 
+/**
+ *  Provides the thumbnail of the notes of the pattern, rendering it only if
+ *  the pattern has been edited (or recolored) since it was last rendered,
+ *  or if no button of this size has rendered it yet.  The fingerprint of a
+ *  long pattern is also recalculated only then.
+ */
+
+const QPixmap &
+qloopbutton::pattern_thumbnail ()
+{
+    seq::pointer s = loop();
+    thumbkey key(s.get(), width(), height());
+    auto ti = sm_thumbnails.find(key);
+    if (ti == sm_thumbnails.end())
+    {
+        if (sm_thumbnails.size() >= sm_thumbnail_limit)
+            sm_thumbnails.clear();
+
+        for (auto t = sm_thumbnails.begin(); t != sm_thumbnails.end(); /**/)
+        {
+            if (t->second.m_owner.expired())        /* pattern is deleted   */
+                t = sm_thumbnails.erase(t);
+            else
+                ++t;
+        }
+        ti = sm_thumbnails.emplace(key, thumbnail()).first;
+    }
+
+    thumbnail & t = ti->second;
+    bool current =
+        ! t.m_pixmap.isNull() && ! t.m_owner.expired() &&
+        t.m_generation == s->edit_generation() &&
+        t.m_color == s->color() &&
+        t.m_transposable == s->transposable();
+
+    if (! current)
+    {
+        QRect box
+        (
+            m_progress_box.x(), m_progress_box.y(),
+            m_progress_box.w(), m_progress_box.h()
+        );
+        qreal ratio = devicePixelRatioF();
+        t.m_owner = s;
+        t.m_generation = s->edit_generation();
+        t.m_color = s->color();
+        t.m_transposable = s->transposable();
+        t.m_pixmap = QPixmap(box.size() * ratio);
+        t.m_pixmap.setDevicePixelRatio(ratio);
+        t.m_pixmap.fill(Qt::transparent);
+        m_fingerprint_inited = m_fingerprinted = false;
+        initialize_fingerprint();
+
+        QPainter painter(&t.m_pixmap);
+        painter.setClipRect(QRect(QPoint(0, 0), box.size()));
+        painter.translate(-box.topLeft());
+        draw_pattern(painter);
+    }
+    return t.m_pixmap;
+}
+
 /**
  *  Sets up the foreground and background colors of the button and the
  *  appropriate setAutoFillBackground() setting. We've removed the garish
@@ -459,6 +556,42 @@ qloopbutton::setup ()
     setAttribute(Qt::WA_Hover, false);              /* avoid nasty repaints */
 }
 
+/**
+ *  Points this button at the pattern of another slot.  The size of the
+ *  button does not change, so the text boxes and progress box are kept, but
+ *  the text, the fingerprint, and the colors must be remade.  The thumbnail
+ *  of the pattern comes from the shared cache, so that switching back to a
+ *  screen-set does not redraw its patterns.  A loop button cannot be rebound
+ *  to an empty slot.
+ */
+
+bool
+qloopbutton::rebind
+(
+    seq::number slotnumber,
+    const std::string & label,
+    const std::string & hotkey,
+    seq::pointer seqp
+)
+{
+    bool result = bool(seqp);
+    if (result)
+    {
+        m_slot_number = slotnumber;
+        m_label = label;
+        m_hotkey = hotkey;
+        m_seq = seqp;
+        m_fingerprint_inited = false;
+        m_fingerprinted = false;
+        m_text_initialized = false;
+        m_label_stamp = 0;
+        set_checked(loop()->armed());
+        set_loop_colors();
+        set_dirty(true);
+    }
+    return result;
+}
+
 void
 qloopbutton::set_checked (bool flag)
 {
@@ -487,6 +620,67 @@ qloopbutton::toggle_checked ()
     return result;
 }
 
+/**
+ *  Packs the pattern status shown in the labels of the button: the edit
+ *  generation (name, length, bus, channel), and the armed, queued,
+ *  one-shot, recording, and modified flags.
+ */
+
+unsigned long
+qloopbutton::label_stamp () const
+{
+    const seq::pointer & s = m_seq;
+    unsigned long result = (unsigned long) s->edit_generation() << 9;
+    if (s->armed())
+        result |= 0x01;
+
+    if (s->get_queued())
+        result |= 0x02;
+
+    if (s->one_shot())
+        result |= 0x04;
+
+    if (s->recording())
+        result |= 0x08;
+
+    if (s->quantizing())
+        result |= 0x10;
+
+    if (s->tightening())
+        result |= 0x20;
+
+    if (s->modified())
+        result |= 0x40;
+
+    if (s->loop_count_max() > 0)
+        result |= 0x80;
+
+    if (s->snap_it())
+        result |= 0x100;
+
+    return result;
+}
+
+/**
+ *  Called by the live grid's timer.  If the status of the pattern has not
+ *  changed since the last full repaint, only the progress box is repainted;
+ *  its notes come from the cached thumbnail.
+ */
+
+void
+qloopbutton::refresh ()
+{
+    if (loop())
+    {
+        unsigned long stamp = label_stamp();
+        bool all = stamp != m_label_stamp;
+        m_label_stamp = stamp;
+        reupdate(all);
+    }
+    else
+        reupdate(false);
+}
+
 /**
  *  Call the update() function of this button.
  *
@@ -583,20 +777,14 @@ qloopbutton::paintEvent (QPaintEvent * pev)
                 int cly = m_top_right.m_y + m_top_right.m_h;
                 int tlx = clx + usr().scale_size(2);
                 int tly = cly + radius - usr().scale_size(2);
-                QPen pen2(drum_paint());
-                QBrush brush(drum_paint(), Qt::SolidPattern);
                 painter.save();
-                painter.setPen(pen2);
-                painter.setBrush(brush);
+                painter.setPen(drum_paint());
+                painter.setBrush(QBrush(drum_paint(), Qt::SolidPattern));
                 painter.drawEllipse(clx, cly, radius, radius);
                 if (loop()->quantizing_or_tightening())
                 {
-                    int fontsize = usr().scale_font_size(s_fontsize_record);
-                    QFont font;
-                    font.setPointSize(fontsize);
-                    font.setBold(true);
                     painter.setPen(Qt::black);
-                    painter.setFont(font);
+                    painter.setFont(m_record_font);
                     if (loop()->quantizing())
                         painter.drawText(tlx, tly, "Q");
                     else if (loop()->tightening())
@@ -647,12 +835,15 @@ qloopbutton::paintEvent (QPaintEvent * pev)
                 );
                 painter.drawText(box, m_top_left.m_flags, title);
             }
-            initialize_fingerprint();
         }
         if (sm_draw_progress_box)
             draw_progress_box(painter);
 
-        draw_pattern(painter);
+        if (loop()->event_count() > 0)
+        {
+            QPoint corner(m_progress_box.x(), m_progress_box.y());
+            painter.drawPixmap(corner, pattern_thumbnail());
+        }
 
         bool tiny = ! (loop()->is_playable() && loop()->armed());
         draw_progress(painter, tick, tiny);
@@ -686,8 +877,6 @@ qloopbutton::draw_progress
     midipulse t1 = loop()->get_length();
     if (t1 > 0)
     {
-        QBrush brush(m_prog_back_color, Qt::SolidPattern);
-        QPen pen(progress_color());                         /* Qt::black */
         int x = m_event_box.x();
         int w = m_event_box.w();
         int yh;
@@ -706,10 +895,7 @@ qloopbutton::draw_progress
         int y0 = m_event_box.y() + yoffset;
         int y1 = y0 + yh;
         x += int(w * tick / t1);
-        pen.setWidth(m_prog_thickness);
-        pen.setStyle(Qt::SolidLine);
-        painter.setBrush(brush);
-        painter.setPen(pen);
+        painter.setPen(m_progress_pen);
         painter.drawLine(x, y1, x, y0);
     }
 }
@@ -37,6 +37,8 @@
  *  handle.  That is, if moving or growing, snap the tick.
  */
 
+#include <algorithm>                    /* std::min(), std::max()           */
+
 #include <QKeyEvent>
 #include <QMouseEvent>
 #include <QPainter>
@@ -85,6 +87,19 @@ static const int s_vfont_size_small     =  8;
 static const int s_vfont_size_normal    = 12;
 static const int s_vfont_size_large     = 16;
 
+/**
+ *  Tile sizes for the cached rendering of the grid and triggers.  A tile is
+ *  c_tile_width pixels wide and c_tile_tracks tracks high.  If more than
+ *  c_tile_limit tiles are cached, the ones out of view are dropped.  The
+ *  margin lets a tile pick up trigger handles and transposition labels that
+ *  start in a neighboring tile.
+ */
+
+static const int c_tile_width           = 512;
+static const int c_tile_tracks          = 16;
+static const int c_tile_margin          = 32;
+static const std::size_t c_tile_limit   = 64;
+
 /**
  *  Principal constructor.
  */
@@ -118,7 +133,14 @@ qperfroll::qperfroll
     m_last_tick         (0),
     m_box_select        (false),
     m_grow_direction    (false),
-    m_adding_pressed    (false)
+    m_adding_pressed    (false),
+    m_tiles             (),
+    m_tile_zoom         (0),
+    m_tile_track_height (0),
+    m_tile_beat         (0),
+    m_tile_measure      (0),
+    m_tile_size         (),
+    m_track_cache       ()
 {
     setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::MinimumExpanding);
     setFocusPolicy(Qt::StrongFocus);
@@ -140,21 +162,211 @@ qperfroll::~qperfroll ()
 }
 
 /**
- *  Calls update() if needed, and also implements follow-progress.
+ *  Calls update() if needed, and also implements follow-progress.  If this
+ *  widget has not been marked dirty, and the visible tiles still match their
+ *  tracks, then only the playhead has moved, and only the strips it leaves
+ *  and enters are repainted.
  */
 
 void
 qperfroll::conditional_update ()
 {
-    if (perf().needs_update() || check_dirty())
+    bool dirty = qbase::check_dirty();      /* this widget's own flag   */
+    if (dirty || perf().needs_update())
     {
         if (perf().follow_progress())
             follow_progress();              /* keep up with progress    */
 
-        update();
+        if (dirty || ! tiles_current(visibleRegion().boundingRect()))
+            update();
+        else
+            update_progress();
+    }
+}
+
+/**
+ *  Repaints the old and the new location of the playhead.
+ */
+
+void
+qperfroll::update_progress ()
+{
+    int x = tix_to_pix(perf().get_tick());
+    if (x != progress_x())
+    {
+        int w = c_pen_width + 2;
+        update(progress_x() - w, 0, 2 * w, height());
+        update(x - w, 0, 2 * w, height());
+    }
+}
+
+/**
+ *  Provides the widget area covered by a tile.
+ */
+
+QRect
+qperfroll::tile_rect (int column, int row) const
+{
+    int h = c_tile_tracks * track_height();
+    return QRect(column * c_tile_width, row * h, c_tile_width, h);
+}
+
+/**
+ *  Provides the stamp of what is drawn for a track.  An inactive track gets
+ *  a null sequence pointer.  Selecting, moving, or editing triggers bumps the
+ *  edit generation of the sequence; the armed status shows in the alpha of
+ *  the trigger color.
+ */
+
+qperfroll::stamp
+qperfroll::track_stamp (int seqid) const
+{
+    stamp result(nullptr, 0);
+    if (seqid >= 0 && perf().is_seq_active(seqid))
+    {
+        seq::pointer s = perf().get_sequence(seqid);
+        unsigned long c = (unsigned long) (perf().color(seqid) & 0xff);
+        result.first = s.get();
+        result.second = (((unsigned long) s->edit_generation()) << 9) |
+            (c << 1) | (s->armed() ? 1 : 0);
+    }
+    return result;
+}
+
+/**
+ *  Provides the notes of a track and their range, fetching them from the
+ *  note index only if the pattern has been edited since the last fetch.
+ *
+ * \param seqid
+ *      The track number.
+ *
+ * \param s
+ *      The pattern of that track.
+ *
+ * \return
+ *      Returns the cached notes.
+ */
+
+const qperfroll::trackcache &
+qperfroll::track_notes (int seqid, sequence & s)
+{
+    stamp st(&s, (unsigned long) s.edit_generation());
+    trackcache & tc = m_track_cache[seqid];
+    if (tc.tc_stamp != st)
+    {
+        tc.tc_stamp = st;
+        tc.tc_notes.clear();
+        (void) s.minmax_notes(tc.tc_note_min, tc.tc_note_max);
+        (void) s.notes_in_range
+        (
+            0, s.get_max_timestamp(), 0, c_note_max, tc.tc_notes
+        );
+    }
+    return tc;
+}
+
+/**
+ *  Checks that the tracks drawn in a tile are unchanged.  The tracks just
+ *  above and below the tile are included, since their trigger boxes can
+ *  spill a pixel into it.
+ */
+
+bool
+qperfroll::tile_current (const tile & t, int row) const
+{
+    if (t.t_pixmap.isNull())
+        return false;
+
+    int seqid = row * c_tile_tracks - 1;
+    for (const auto & st : t.t_stamps)
+    {
+        if (st != track_stamp(seqid++))
+            return false;
+    }
+    return true;
+}
+
+/**
+ *  Checks that all of the tiles covering an area are cached and current.
+ *  Called by the timer to decide if more than the playhead needs repainting.
+ */
+
+bool
+qperfroll::tiles_current (const QRect & area) const
+{
+    if (area.isEmpty())
+        return true;
+
+    int h = c_tile_tracks * track_height();
+    int c0 = area.x() / c_tile_width;
+    int c1 = (area.x() + area.width() - 1) / c_tile_width;
+    int r0 = area.y() / h;
+    int r1 = (area.y() + area.height() - 1) / h;
+    for (int row = r0; row <= r1; ++row)
+    {
+        for (int column = c0; column <= c1; ++column)
+        {
+            auto ti = m_tiles.find(tilekey(column, row));
+            if (ti == m_tiles.end() || ! tile_current(ti->second, row))
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ *  Drops all of the tiles if the zoom, the track height, the guides, or the
+ *  size of the widget have changed.
+ */
+
+void
+qperfroll::check_tile_layout ()
+{
+    bool changed =
+        m_tile_zoom != scale_zoom() ||
+        m_tile_track_height != track_height() ||
+        m_tile_beat != beat_length() ||
+        m_tile_measure != measure_length() ||
+        m_tile_size != size();
+
+    if (changed)
+    {
+        m_tiles.clear();
+        m_tile_zoom = scale_zoom();
+        m_tile_track_height = track_height();
+        m_tile_beat = beat_length();
+        m_tile_measure = measure_length();
+        m_tile_size = size();
     }
 }
 
+/**
+ *  Draws the grid and triggers of a tile into its pixmap, and saves the
+ *  stamps of its tracks.  The painter is translated so that the drawing code
+ *  can use widget coordinates.
+ */
+
+void
+qperfroll::render_tile (tile & t, int column, int row)
+{
+    QRect area = tile_rect(column, row);
+    qreal ratio = devicePixelRatioF();
+    if (t.t_pixmap.isNull())
+    {
+        t.t_pixmap = QPixmap(area.size() * ratio);
+        t.t_pixmap.setDevicePixelRatio(ratio);
+    }
+    t.t_pixmap.fill(back_color());
+    t.t_stamps.clear();
+    for (int track = -1; track <= c_tile_tracks; ++track)
+        t.t_stamps.push_back(track_stamp(row * c_tile_tracks + track));
+
+    QPainter painter(&t.t_pixmap);
+    painter.translate(-area.topLeft());
+    draw_grid(painter, area);
+    draw_triggers(painter, area);
+}
+
 /**
  *  Checks the position of the tick, and, if it is in a different piano-roll
  *  "page" than the last page, moves the page to the next page.
@@ -168,25 +380,52 @@ qperfroll::follow_progress ()
 }
 
 /**
- *  Draws and redraws the performance roll.
+ *  Draws and redraws the performance roll.  The grid and the triggers are
+ *  copied from the cached tiles that cover the damaged area, redrawing only
+ *  the tiles whose tracks have changed.  With many tracks and a long song,
+ *  the timer-driven repaints then cost little more than the playhead.
  */
 
 void
-qperfroll::paintEvent (QPaintEvent * /*qpep*/)
+qperfroll::paintEvent (QPaintEvent * qpep)
 {
     QPainter painter(this);
-    QRect r(0, 0, width(), height());
+    QRect r = qpep->rect();
     QBrush brush(Qt::white, Qt::NoBrush);
     QPen pen(fore_color());
-    pen.setStyle(Qt::SolidLine);
-    painter.setPen(pen);
-    painter.setBrush(brush);
-    painter.drawRect(0, 0, width(), height());
     if (! is_initialized())
         set_initialized();
 
-    draw_grid(painter, r);
-    draw_triggers(painter, r);
+    check_tile_layout();
+
+    int th = c_tile_tracks * track_height();
+    int c0 = r.x() / c_tile_width;
+    int c1 = (r.x() + r.width() - 1) / c_tile_width;
+    int r0 = r.y() / th;
+    int r1 = (r.y() + r.height() - 1) / th;
+    for (int row = r0; row <= r1; ++row)
+    {
+        for (int column = c0; column <= c1; ++column)
+        {
+            tile & t = m_tiles[tilekey(column, row)];
+            if (! tile_current(t, row))
+                render_tile(t, column, row);
+
+            painter.drawPixmap(tile_rect(column, row).topLeft(), t.t_pixmap);
+        }
+    }
+    if (m_tiles.size() > c_tile_limit)
+    {
+        QRect visible = visibleRegion().boundingRect().united(r);
+        for (auto ti = m_tiles.begin(); ti != m_tiles.end(); /* inside */)
+        {
+            QRect tr = tile_rect(ti->first.first, ti->first.second);
+            if (tr.intersects(visible))
+                ++ti;
+            else
+                ti = m_tiles.erase(ti);
+        }
+    }
 
     /*
      * Draw selections, if applicable.  Currently, only one box can be selected.
@@ -228,14 +467,15 @@ qperfroll::paintEvent (QPaintEvent * /*qpep*/)
 #endif
 
     midipulse tick = perf().get_tick();         /* draw progress playhead   */
-    int progress_x = tix_to_pix(tick);          /* tick / scale_zoom()      */
+    old_progress_x(progress_x());
+    progress_x(tix_to_pix(tick));               /* tick / scale_zoom()      */
     pen.setColor(progress_color());
     pen.setStyle(Qt::SolidLine);
     if (usr().progress_bar_thick())
         pen.setWidth(c_pen_width);
 
     painter.setPen(pen);
-    painter.drawLine(progress_x, 1, progress_x, height() - 2);
+    painter.drawLine(progress_x(), 1, progress_x(), height() - 2);
 }
 
 bool
@@ -887,11 +1127,24 @@ qperfroll::redo ()
     perf().pop_trigger_redo();
 }
 
+/**
+ *  Draws the grid lines that fall within the given area, plus a track and a
+ *  beat of margin so that the wide lines at the edges of a tile are whole.
+ *
+ * \param painter
+ *      The painter, which is clipped to the area or to a tile covering it.
+ *
+ * \param r
+ *      The area to draw, in widget coordinates.
+ */
+
 void
 qperfroll::draw_grid (QPainter & painter, const QRect & r)
 {
-    int xwidth = r.width();
-    int yheight = r.height();
+    int x0 = r.x();
+    int x1 = r.x() + r.width();
+    int y0 = r.y();
+    int y1 = r.y() + r.height();
     QBrush brush(back_color());                         /* Qt::NoBrush      */
     QPen pen(fore_color());                             /* Qt::black        */
     pen.setStyle(Qt::SolidLine);
@@ -899,10 +1152,13 @@ qperfroll::draw_grid (QPainter & painter, const QRect & r)
     painter.setPen(pen);
     painter.setBrush(brush);
     painter.drawRect(0, 0, width(), height());          /* full width       */
-    for (int i = 0; i < height(); i += track_height())  /* horizontal lines */
+
+    int th = track_height();
+    int ylimit = std::min(height(), y1 + th);
+    for (int i = (y0 / th) * th; i < ylimit; i += th)   /* horizontal lines */
     {
         int y = i + c_ycorrection;                      /* - 2 */
-        painter.drawLine(0, y, xwidth, y);
+        painter.drawLine(x0, y, x1, y);
     }
 
     /*
@@ -910,10 +1166,10 @@ qperfroll::draw_grid (QPainter & painter, const QRect & r)
      *  the beat-length (PPQN) makes drawing go faster.
      */
 
-    midipulse tick0 = scroll_offset();
-    midipulse windowticks = pix_to_tix(xwidth);
-    midipulse tick1 = tick0 + windowticks;
     midipulse tickstep = beat_length();                 /* versus 1         */
+    midipulse tick0 = scroll_offset() + pix_to_tix(x0);
+    midipulse tick1 = scroll_offset() + pix_to_tix(x1) + tickstep;
+    tick0 -= tick0 % tickstep;                          /* back to a beat   */
     int penwidth = 1;
     for (midipulse tick = tick0; tick < tick1; tick += tickstep)
     {
@@ -930,15 +1186,30 @@ qperfroll::draw_grid (QPainter & painter, const QRect & r)
         }
         pen.setWidth(penwidth);
         painter.setPen(pen);
-        painter.drawLine(x_pos, 0, x_pos, yheight);
+        painter.drawLine(x_pos, y0, x_pos, y1);
     }
 }
 
+/**
+ *  Draws the triggers of the tracks within the given area.  Triggers, and
+ *  repetitions of the pattern within a trigger, that lie outside of the area
+ *  are skipped.  The notes of each track come from track_notes(), which
+ *  fetches them from the note index only when the pattern has changed.
+ *
+ * \param painter
+ *      The painter, which is clipped to the area or to a tile covering it.
+ *
+ * \param r
+ *      The area to draw, in widget coordinates.
+ */
+
 void
 qperfroll::draw_triggers (QPainter & painter, const QRect & r)
 {
-    int y_s = 0;
-    int y_f = r.height() / track_height();
+    int y_s = std::max(r.y() / track_height() - 1, 0);
+    int y_f = (r.y() + r.height()) / track_height();
+    int x_s = r.x() - c_tile_margin;
+    int x_f = r.x() + r.width() + c_tile_margin;
     int cbw = c_size_box_w;                     /* copied for readability   */
     QBrush brush(Qt::NoBrush);
     QPen pen(fore_color());
@@ -978,6 +1249,13 @@ qperfroll::draw_triggers (QPainter & painter, const QRect & r)
             int lenw = tix_to_pix(lens);
             int h = track_height() - 1;
             int cbwoffset = cbw + h / 2 - 2;
+            const trackcache & tc = track_notes(seqid, *s);
+            const sequence::notelist & notes = tc.tc_notes;
+            int note0 = tc.tc_note_min;
+            int note1 = tc.tc_note_max;
+            int height = note1 - note0;
+            height += 2;
+
             trigger trig;
             painter.setFont(m_font);
             s->reset_draw_trigger_marker();
@@ -987,6 +1265,9 @@ qperfroll::draw_triggers (QPainter & painter, const QRect & r)
                 {
                     int x_on = tix_to_pix(trig.tick_start());
                     int x_off = tix_to_pix(trig.tick_end());
+                    if (x_off < x_s || x_on > x_f)
+                        continue;                       /* not in the area  */
+
                     int w = x_off - x_on + 1;
                     int x = x_on;
                     int xmax = x_off + 1;               /* same as x + w    */
@@ -1068,29 +1349,26 @@ qperfroll::draw_triggers (QPainter & painter, const QRect & r)
                     }
 
                     midipulse t = trig.trigger_marker(lens);    /* offset   */
-                    while (t < trig.tick_end())
-                    {
-                        int note0, note1;
-                        (void) s->minmax_notes(note0, note1);
-
-                        int height = note1 - note0;
-                        height += 2;
-                        if (s->transposable())
-                            pen.setColor(fore_color());
-                        else
-                            pen.setColor(drum_color());
+                    midipulse tick_x = pix_to_tix(x_s);
+                    if (lens > 0 && t + lens < tick_x)          /* skip out */
+                        t += ((tick_x - t) / lens - 1) * lens;
 
-                        painter.setPen(pen);
+                    if (s->transposable())
+                        pen.setColor(fore_color());
+                    else
+                        pen.setColor(drum_color());
 
+                    painter.setPen(pen);
+                    while (t < trig.tick_end())
+                    {
                         int cny = track_height() - 6;
                         int marker_x = tix_to_pix(t);
-                        for (auto cev = s->cbegin(); ! s->cend(cev); ++cev)
-                        {
-                            sequence::note_info ni;
-                            sequence::draw dt = s->get_next_note(ni, cev);
-                            if (dt == sequence::draw::finish)
-                                break;
+                        if (marker_x > x_f)
+                            break;                      /* past the area    */
 
+                        for (const auto & ni : notes)
+                        {
+                            sequence::draw dt = ni.draw_type();
                             midipulse tick_s = ni.start();
                             int sx = tick_s * lenw / lens + marker_x;
                             if (dt == sequence::draw::tempo)
@@ -167,7 +167,9 @@ qseqdata::sizeHint () const
 }
 
 /**
- *  We create an iterator and use sequence::get_next_event_match().
+ *  We create an iterator and use sequence::get_next_event_match().  The
+ *  iterator starts at the first event in the damaged area (found by a binary
+ *  search), and the loop stops at the first event past that area.
  */
 
 void
@@ -186,13 +188,16 @@ qseqdata::paintEvent (QPaintEvent * qpep)
     midipulse start_tick = pix_to_tix(r.x());
     midipulse end_tick = start_tick + pix_to_tix(r.width());
     track().draw_lock();
-    for (auto cev = track().cbegin(); ! track().cend(cev); ++cev)
+    for (auto cev = track().cbegin(start_tick); ! track().cend(cev); ++cev)
     {
         if (! track().get_next_event_match(m_status, m_cc, cev))
             break;
 
         midipulse tick = cev->timestamp();
-        if (tick >= start_tick && tick <= end_tick)
+        if (tick > end_tick)
+            break;                              /* events are sorted        */
+
+        if (tick >= start_tick)
         {
             bool normal_event = ! cev->is_tempo() && ! cev->is_program_change();
             bool selected = cev->is_selected();
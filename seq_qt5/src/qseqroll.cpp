@@ -105,7 +105,12 @@ qseqroll::qseqroll
     m_keypadding_x          (c_keyboard_padding_x),
     m_v_zooming             (false),
     m_last_base_note        (-1),
-    m_link_wraparound       (usr().new_pattern_wraparound())
+    m_link_wraparound       (usr().new_pattern_wraparound()),
+    m_backing               (),
+    m_backing_rect          (),
+    m_backing_generation    (0),
+    m_backing_bg_generation (0),
+    m_backing_stale         (true)
 {
     setAttribute(Qt::WA_StaticContents);
     setAttribute(Qt::WA_OpaquePaintEvent);          /* no erase on repaint  */
@@ -134,20 +139,111 @@ qseqroll::~qseqroll ()
  *  In an effort to reduce CPU usage when simply idling, this function calls
  *  update() only if necessary.  See qseqbase::check_dirty().
  *
+ *  While playing, the performer always needs an update, but usually only the
+ *  playhead has moved.  If this widget is not dirty (e.g. from a selection
+ *  box being dragged) and the cached grid and notes are still good, only
+ *  the strips under the old and new playhead are repainted.
+ *
  *  bool ok = track().playing();
  */
 
 void
 qseqroll::conditional_update ()
 {
-    bool ok = perf().needs_update() || check_dirty();
+    bool dirty = qbase::check_dirty();      /* this widget's own flag   */
+    bool ok = dirty || perf().needs_update() || check_dirty();
     if (ok)
     {
         if (progress_follow())
             follow_progress();              /* keep up with progress    */
 
-        update();
+        if (dirty || backing_stale())
+            update();
+        else
+            update_progress();
+    }
+}
+
+/**
+ *  Determines if the cached grid and notes need to be redrawn.  This is the
+ *  case if set_dirty() was called, if the edit mode changed, or if the
+ *  edited (or background) sequence has been edited since the last rendering.
+ */
+
+bool
+qseqroll::backing_stale () const
+{
+    bool result = m_backing_stale || m_backing.isNull();
+    if (! result)
+        result = track().edit_generation() != m_backing_generation;
+
+    if (! result)
+        result = m_edit_mode != perf().edit_mode(track().seq_number());
+
+    if (! result && m_draw_background_seq)
+    {
+        const seq::pointer b = perf().get_sequence(m_background_sequence);
+        if (b)
+            result = b->edit_generation() != m_backing_bg_generation;
+    }
+    return result;
+}
+
+/**
+ *  Requests a repaint of only the areas under the previous and the current
+ *  playhead.  Qt merges the two rectangles into one paint event.
+ */
+
+void
+qseqroll::update_progress ()
+{
+    int x = xoffset(track().get_tick());
+    if (x != progress_x())
+    {
+        int w = m_progbar_width + 2;
+        update(progress_x() - w, 0, 2 * w, height());
+        update(x - w, 0, 2 * w, height());
+    }
+}
+
+/**
+ *  Draws the grid and the notes into the backing pixmap, covering the given
+ *  area of the widget.  The painter is translated so that the drawing code
+ *  can use widget coordinates as before.
+ *
+ * \param area
+ *      The visible area of the widget, in widget coordinates.
+ */
+
+void
+qseqroll::render_backing (const QRect & area)
+{
+    QRect view(0, 0, width(), height());
+    qreal ratio = devicePixelRatioF();
+    m_edit_mode = perf().edit_mode(track().seq_number());
+    m_backing_stale = false;
+    m_backing_generation = track().edit_generation();
+    if (m_draw_background_seq)
+    {
+        const seq::pointer b = perf().get_sequence(m_background_sequence);
+        if (b)
+            m_backing_bg_generation = b->edit_generation();
     }
+    if (m_backing_rect.size() != area.size() || m_backing.isNull())
+    {
+        m_backing = QPixmap(area.size() * ratio);
+        m_backing.setDevicePixelRatio(ratio);
+    }
+    m_backing_rect = area;
+
+    QPainter painter(&m_backing);
+    QPen pen(Qt::lightGray);
+    pen.setStyle(Qt::SolidLine);
+    painter.setPen(pen);
+    painter.setFont(m_font);
+    painter.translate(-area.topLeft());
+    draw_grid(painter, view);
+    call_draw_notes(painter, area);
 }
 
 /**
@@ -317,8 +413,10 @@ qseqroll::set_redraw ()
  *  humongous value (38800+).  So we store the current values to use, via
  *  window_width() and window_height(), in follow_progress().
  *
- *  We have to decide how to handle repaints after the initialization.  Do we
- *  use the QRect of the paint-event?
+ *  The grid and notes are drawn only for the visible part of the widget, and
+ *  are cached in m_backing.  The damaged rectangle of the paint-event is
+ *  copied from that pixmap, and the playhead and selection boxes are drawn
+ *  over it.
  *
  *  Here, we could choose black instead white for "inverse" mode.
  */
@@ -327,31 +425,26 @@ void
 qseqroll::paintEvent (QPaintEvent * qpep)
 {
     QRect r = qpep->rect();
-    QRect view(0, 0, width(), height());
+    QRect visible = visibleRegion().boundingRect();
+    if (visible.isEmpty())
+        visible = r;
+    else if (! visible.contains(r))
+        visible = visible.united(r);
+
+    m_frame_ticks = pix_to_tix(visible.width());
+    if (backing_stale() || visible != m_backing_rect)
+        render_backing(visible);
+
     QPainter painter(this);
     QBrush brush(blank_brush());    // QBrush brush(Qt::white, Qt::NoBrush);
     QPen pen(Qt::lightGray);
     pen.setStyle(Qt::SolidLine);
-    pen.setColor(Qt::lightGray);
-    painter.setPen(pen);
     painter.setFont(m_font);
-    m_frame_ticks = pix_to_tix(r.width());
-    m_edit_mode = perf().edit_mode(track().seq_number());
-
-    /*
-     * Draw the border and grid. See the banner notes about width and height.
-     * Doesn't seem to be needed: painter.drawRect(0, 0, ww, wh);
-     */
-
-    draw_grid(painter, view);
+    qreal ratio = m_backing.devicePixelRatio();
+    QRectF source(r.translated(-m_backing_rect.topLeft()));
+    source = QRectF(source.topLeft() * ratio, source.size() * ratio);
+    painter.drawPixmap(QRectF(r), m_backing, source);
     set_initialized();
-
-    /*
-     * Draw the events. This currently draws all of them.  Drawing all them
-     * only needs to be drawn once.
-     */
-
-    call_draw_notes(painter, view);
     pen.setWidth(c_pen_width);
 
     /*
@@ -566,10 +659,28 @@ qseqroll::draw_grid (QPainter & painter, const QRect & r)
     }
 }
 
+/**
+ *  Calculates the range of notes covered (even partly) by the given area of
+ *  the widget, for use with sequence::notes_in_range().
+ */
+
+void
+qseqroll::visible_notes (const QRect & r, int & note_l, int & note_h)
+{
+    midipulse tick;
+    convert_xy(0, r.y(), tick, note_h);
+    convert_xy(0, r.y() + r.height(), tick, note_l);
+    if (note_h < c_note_max)
+        ++note_h;
+
+    if (note_l > 0)
+        --note_l;
+}
+
 /**
  * Draw the current pixmap frame.  Note that, if the width and height change, we
- * will have to reevaluate.  Draw the events. This currently draws all of them.
- * Drawing all them only needs to be drawn once.
+ * will have to reevaluate.  Only the notes that overlap the given area are
+ * obtained from the sequence, via its time index.
  */
 
 void
@@ -600,14 +711,13 @@ qseqroll::draw_notes
     int unitheight = unit_height();
     int unitdecr = unit_height() - 2;
     int noteheight = unitheight - 3;
-    s->draw_lock();
-    for (auto cev = s->cbegin(); ! s->cend(cev); ++cev)
+    int note_l, note_h;
+    sequence::notelist notes;
+    visible_notes(r, note_l, note_h);
+    (void) s->notes_in_range(start_tick, end_tick, note_l, note_h, notes);
+    for (const auto & ni : notes)
     {
-        sequence::note_info ni;
-        sequence::draw dt = s->get_next_note(ni, cev);
-        if (dt == sequence::draw::finish)
-            break;
-
+        sequence::draw dt = ni.draw_type();
         if (dt == sequence::draw::tempo)
         {
 #if defined SEQ66_SHOW_TEMPO_IN_PIANO_ROLL
@@ -624,45 +734,79 @@ qseqroll::draw_notes
             continue;
         }
 
-        bool start_in = ni.start() >= start_tick && ni.start() <= end_tick;
-        bool end_in = ni.finish() >= start_tick && ni.finish() <= end_tick;
-        bool linkedin = dt == sequence::draw::linked && end_in;
         bool bad = false;
-        if (start_in || linkedin)
+        int in_shift = 0;
+        int length_add = 0;
+        m_note_x = xoffset(ni.start());
+        m_note_y = total_height() - (ni.note() * unitheight) - unitdecr;
+        if (dt == sequence::draw::linked)
         {
-            int in_shift = 0;
-            int length_add = 0;
-            m_note_x = xoffset(ni.start());
-            m_note_y = total_height() - (ni.note() * unitheight) - unitdecr;
-            if (dt == sequence::draw::linked)
+            if (ni.finish() >= ni.start())
             {
-                if (ni.finish() >= ni.start())
-                {
-                    m_note_width = tix_to_pix(ni.finish() - ni.start());
-                    if (m_note_width < 1)
-                        m_note_width = 1;
-                }
-                else
-                    m_note_width = tix_to_pix(seqlength - ni.start());
+                m_note_width = tix_to_pix(ni.finish() - ni.start());
+                if (m_note_width < 1)
+                    m_note_width = 1;
             }
             else
-                m_note_width = tix_to_pix(16);
+                m_note_width = tix_to_pix(seqlength - ni.start());
+        }
+        else
+            m_note_width = tix_to_pix(16);
 
-            if (dt == sequence::draw::note_on)      /* means it's unlinked  */
+        if (dt == sequence::draw::note_on)      /* means it's unlinked  */
+        {
+            in_shift = 0;
+            length_add = 2;
+            bad = true;
+            painter.setBrush(error_brush);
+        }
+        else if (dt == sequence::draw::note_off)
+        {
+            in_shift = -1;
+            length_add = 1;
+            bad = true;
+            painter.setBrush(error_brush);
+        }
+        if (background)                         /* draw background note */
+        {
+            length_add = 1;
+            painter.setBrush(backseq_brush());
+        }
+        else
+        {
+            painter.setBrush(note_brush());
+        }
+        painter.drawRect(m_note_x, m_note_y, m_note_width, noteheight);
+        if (use_gradient())
+        {
+            if (background)
             {
-                in_shift = 0;
-                length_add = 2;
-                bad = true;
-                painter.setBrush(error_brush);
+                length_add = 1;
+                painter.setBrush(backseq_brush());
+                painter.drawRect
+                (
+                    m_note_x, m_note_y, m_note_width, noteheight
+                );
             }
-            else if (dt == sequence::draw::note_off)
+            else
             {
-                in_shift = -1;
-                length_add = 1;
-                bad = true;
-                painter.setBrush(error_brush);
+                QLinearGradient grad
+                (
+                    m_note_x, m_note_y, m_note_x, m_note_y + noteheight
+                );
+                grad.setColorAt(0.05, fore_color());
+                grad.setColorAt(0.5,  note_in_color());
+                grad.setColorAt(0.95, fore_color());
+                painter.fillRect
+                (
+                    m_note_x, m_note_y, m_note_width, noteheight, grad
+                );
             }
-            if (background)                         /* draw background note */
+        }
+        else
+        {
+#if COMMENTED_CODE_WAS_NOT_MOVED_TO_HERE
+            if (background)                     /* draw background note */
             {
                 length_add = 1;
                 painter.setBrush(backseq_brush());
@@ -672,134 +816,93 @@ qseqroll::draw_notes
                 painter.setBrush(note_brush());
             }
             painter.drawRect(m_note_x, m_note_y, m_note_width, noteheight);
-            if (use_gradient())
-            {
-                if (background)
-                {
-                    length_add = 1;
-                    painter.setBrush(backseq_brush());
-                    painter.drawRect
-                    (
-                        m_note_x, m_note_y, m_note_width, noteheight
-                    );
-                }
-                else
-                {
-                    QLinearGradient grad
-                    (
-                        m_note_x, m_note_y, m_note_x, m_note_y + noteheight
-                    );
-                    grad.setColorAt(0.05, fore_color());
-                    grad.setColorAt(0.5,  note_in_color());
-                    grad.setColorAt(0.95, fore_color());
-                    painter.fillRect
-                    (
-                        m_note_x, m_note_y, m_note_width, noteheight, grad
-                    );
-                }
-            }
-            else
-            {
-#if COMMENTED_CODE_WAS_NOT_MOVED_TO_HERE
-                if (background)                     /* draw background note */
-                {
-                    length_add = 1;
-                    painter.setBrush(backseq_brush());
-                }
-                else
-                {
-                    painter.setBrush(note_brush());
-                }
-                painter.drawRect(m_note_x, m_note_y, m_note_width, noteheight);
 #endif
-            }
-            if (m_link_wraparound)
+        }
+        if (m_link_wraparound)
+        {
+            if (ni.finish() < ni.start())       /* shadow these notes   */
             {
-                if (ni.finish() < ni.start())       /* shadow these notes   */
-                {
-                    int len = tix_to_pix(ni.finish()) - m_note_off_margin;
-                    painter.setPen(error_pen);
-                    painter.drawRect(m_keypadding_x, m_note_y, len, noteheight);
-                    painter.setPen(pen);
-                }
+                int len = tix_to_pix(ni.finish()) - m_note_off_margin;
+                painter.setPen(error_pen);
+                painter.drawRect(m_keypadding_x, m_note_y, len, noteheight);
+                painter.setPen(pen);
             }
+        }
 
-            /*
-             * Draw note highlight if there's room.  Orange note if selected,
-             * red if drum mode, otherwise plain white.
-             */
+        /*
+         * Draw note highlight if there's room.  Orange note if selected,
+         * red if drum mode, otherwise plain white.
+         */
 
-            if (m_note_width > 3)
-            {
+        if (m_note_width > 3)
+        {
 #if COMMENTED_CODE_WAS_NOT_MOVED_BELOW
-                if (ni.selected())
-                    brush.setColor(sel_color());        /* was "orange"    */
-                else
-                    brush.setColor(note_in_color());    /* was Qt::white   */
+            if (ni.selected())
+                brush.setColor(sel_color());        /* was "orange"    */
+            else
+                brush.setColor(note_in_color());    /* was Qt::white   */
 
-                if (bad)
-                    painter.setBrush(error_brush);
-                else
-                    painter.setBrush(brush);
+            if (bad)
+                painter.setBrush(error_brush);
+            else
+                painter.setBrush(brush);
 #endif
 
-                if (! background)
+            if (! background)
+            {
+                int x_shift = m_note_x + in_shift;
+                int h_minus = noteheight - 1;
+                if (use_gradient())
                 {
-                    int x_shift = m_note_x + in_shift;
-                    int h_minus = noteheight - 1;
-                    if (use_gradient())
+                    if (ni.selected())
                     {
-                        if (ni.selected())
-                        {
-                            QLinearGradient grad
-                            (
-                                x_shift, m_note_y, m_note_x, m_note_y + h_minus
-                            );
-                            grad.setColorAt(0.01, fore_color());
-                            grad.setColorAt(0.5,  sel_color());
-                            grad.setColorAt(0.99, fore_color());
-                            painter.fillRect
-                            (
-                                x_shift, m_note_y,
-                                m_note_width + length_add - 1, h_minus, grad
-                            );
-                        }
+                        QLinearGradient grad
+                        (
+                            x_shift, m_note_y, m_note_x, m_note_y + h_minus
+                        );
+                        grad.setColorAt(0.01, fore_color());
+                        grad.setColorAt(0.5,  sel_color());
+                        grad.setColorAt(0.99, fore_color());
+                        painter.fillRect
+                        (
+                            x_shift, m_note_y,
+                            m_note_width + length_add - 1, h_minus, grad
+                        );
                     }
+                }
+                else
+                {
+                    if (ni.selected())
+                        brush.setColor(sel_color());     /* was "orange"  */
                     else
-                    {
-                        if (ni.selected())
-                            brush.setColor(sel_color());     /* was "orange"  */
-                        else
-                            brush.setColor(note_in_color()); /* was Qt::white */
+                        brush.setColor(note_in_color()); /* was Qt::white */
 
-                        if (bad)
-                            painter.setBrush(error_brush);
-                        else
-                            painter.setBrush(brush);
+                    if (bad)
+                        painter.setBrush(error_brush);
+                    else
+                        painter.setBrush(brush);
 
-                        if (ni.finish() >= ni.start())  /* note highlight   */
-                        {
-                            painter.drawRect
-                            (
-                                x_shift, m_note_y,
-                                m_note_width + length_add - 1, h_minus
-                            );
-                        }
-                        else
-                        {
-                            int w = tix_to_pix(ni.finish()) + length_add - 3;
-                            painter.drawRect
-                            (
-                                x_shift, m_note_y, m_note_width, h_minus
-                            );
-                            painter.drawRect(m_keypadding_x, m_note_y, w, h_minus);
-                        }
+                    if (ni.finish() >= ni.start())  /* note highlight   */
+                    {
+                        painter.drawRect
+                        (
+                            x_shift, m_note_y,
+                            m_note_width + length_add - 1, h_minus
+                        );
+                    }
+                    else
+                    {
+                        int w = tix_to_pix(ni.finish()) + length_add - 3;
+                        painter.drawRect
+                        (
+                            x_shift, m_note_y, m_note_width, h_minus
+                        );
+                        painter.drawRect(m_keypadding_x, m_note_y, w, h_minus);
                     }
                 }
             }
         }
     }
-    s->draw_unlock();
 }
 
 /*
@@ -886,13 +989,13 @@ qseqroll::draw_drum_notes
         return;
 
     int noteheight = unit_height();
-    for (auto cev = s->cbegin(); ! s->cend(cev); ++cev)
+    int note_l, note_h;
+    sequence::notelist notes;
+    visible_notes(r, note_l, note_h);
+    (void) s->notes_in_range(start_tick, end_tick, note_l, note_h, notes);
+    for (const auto & ni : notes)
     {
-        sequence::note_info ni;
-        sequence::draw dt = s->get_next_note(ni, cev);
-        if (dt == sequence::draw::finish)
-            break;
-
+        sequence::draw dt = ni.draw_type();
         if (dt == sequence::draw::tempo)
         {
 #if defined SEQ66_SHOW_TEMPO_IN_PIANO_ROLL
@@ -910,28 +1013,22 @@ qseqroll::draw_drum_notes
             continue;
         }
 
-        bool start_in = ni.start() >= start_tick && ni.start() <= end_tick;
-        bool end_in = ni.finish() >= start_tick && ni.finish() <= end_tick;
-        bool linkedin = dt == sequence::draw::linked && end_in;
-        if (start_in || linkedin)
-        {
-            m_note_x = xoffset(ni.start());
-            m_note_y = total_height() - ((ni.note() + 1) * noteheight);
+        m_note_x = xoffset(ni.start());
+        m_note_y = total_height() - ((ni.note() + 1) * noteheight);
 
-            /*
-             * Orange note if selected, red for drum mode.
-             */
+        /*
+         * Orange note if selected, red for drum mode.
+         */
 
-            if (ni.selected())
-                brush.setColor(sel_color());
-            else
-                brush.setColor(drum_paint());
+        if (ni.selected())
+            brush.setColor(sel_color());
+        else
+            brush.setColor(drum_paint());
 
-            pen.setColor(fore_color());
-            painter.setPen(pen);
-            painter.setBrush(brush);
-            draw_drum_note(painter, m_note_x, m_note_y);
-        }
+        pen.setColor(fore_color());
+        painter.setPen(pen);
+        painter.setBrush(brush);
+        draw_drum_note(painter, m_note_x, m_note_y);
     }
 }
 
@@ -1277,7 +1374,7 @@ qseqroll::mouseMoveEvent (QMouseEvent * event)
             (void) add_painted_note(tick, note);
         }
     }
-    set_dirty();
+    qseqbase::set_dirty();              /* the notes layer is still good    */
 }
 
 bool
@@ -30,6 +30,7 @@
  */
 
 #include <QKeyEvent>                    /* Needed for QKeyEvent::accept()   */
+#include <QTimer>                       /* QTimer                           */
 
 #include "seq66-config.h"               /* defines SEQ66_QMAKE_RULES        */
 #include "os/daemonize.hpp"             /* seq66::signal_for_restart()      */
@@ -62,6 +63,13 @@ namespace seq66
 
 static const int c_macro_byte_max = 18;
 
+/**
+ *  The playback statistics are refreshed every this many window-redraw
+ *  periods, about once a second.
+ */
+
+static const int c_stats_redraw_factor = 25;
+
 /**
  *  Principle constructor.
  */
@@ -75,7 +83,8 @@ qsessionframe::qsessionframe
     QFrame          (parent),
     ui              (new Ui::qsessionframe),
     m_main_window   (mainparent),
-    m_performer     (p)
+    m_performer     (p),
+    m_timer         (nullptr)
 {
     ui->setupUi(this);
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
@@ -93,11 +102,22 @@ qsessionframe::qsessionframe
         ui->pushButtonReload, SIGNAL(clicked(bool)),
         this, SLOT(slot_flag_reload())
     );
+    connect
+    (
+        ui->pushButtonResetStats, SIGNAL(clicked(bool)),
+        this, SLOT(slot_reset_stats())
+    );
     populate_macro_combo();
+    slot_update_stats();
+    m_timer = qt_timer
+    (
+        this, "qsessionframe", c_stats_redraw_factor, SLOT(slot_update_stats())
+    );
 }
 
 qsessionframe::~qsessionframe()
 {
+    m_timer->stop();
     delete ui;
 }
 
@@ -113,6 +133,33 @@ qsessionframe::slot_flag_reload ()
     signal_for_restart();           /* warnprint("Session reload request"); */
 }
 
+/**
+ *  Shows the output-thread statistics of the performer, and the lock
+ *  profile if built in.  Skipped when the Session tab is not showing, as it
+ *  usually is not.
+ */
+
+void
+qsessionframe::slot_update_stats ()
+{
+    if (isVisible())
+    {
+        std::string text = perf().play_stats().report();
+        if (recmutex::profiling())
+            text += "\n" + recmutex::profile_report();
+
+        ui->playStatsText->setPlainText(qt(text));
+    }
+}
+
+void
+qsessionframe::slot_reset_stats ()
+{
+    perf().play_stats().clear();
+    recmutex::profile_clear();
+    slot_update_stats();
+}
+
 void
 qsessionframe::populate_macro_combo ()
 {
@@ -359,7 +359,7 @@ qslivegrid::conditional_update ()
                 if (s)
                 {
                     pb->set_checked(s->armed());
-                    pb->reupdate(true);
+                    pb->refresh();              /* progress box if no news  */
                 }
                 else
                     pb->reupdate(false);
@@ -789,26 +789,77 @@ qslivegrid::modify_slot (qslotbutton * newslot, int row, int column)
 }
 
 /**
- *  We have found we need to pause the timer when switching banks while
- *  playing, otherwise there is a high probability of a seqfault, due to
- *  updating the user-interface (which deletes and rebuilts the slot buttons).
+ *  Points the existing slot-buttons at the slots of the current screen-set,
+ *  instead of deleting them and creating new ones.  The grid geometry does
+ *  not change, so the layout is left alone.  Only a slot that changes from
+ *  empty to filled, or the reverse, needs a new button, and that button
+ *  replaces the old one in place, so that m_loop_buttons never holds a
+ *  deleted pointer.
+ *
+ * \return
+ *      Returns false if there are no buttons yet, or a full redraw is
+ *      already pending.  Then the caller must use recreate_all_slots().
+ */
+
+bool
+qslivegrid::rebind_all_slots ()
+{
+    bool result = ! m_loop_buttons.empty() && ! m_redraw_buttons;
+    if (result)
+    {
+        int setsize = perf().screenset_size();
+        int offset = seq_offset();
+        for (int seqno = 0; seqno < setsize; ++seqno)
+        {
+            qslotbutton * pb = m_loop_buttons[seqno];
+            if (is_nullptr(pb))
+                continue;
+
+            int s = seqno + offset;
+            std::string snstring = std::to_string(s);
+            std::string hotkey = perf().lookup_slot_key(s);
+            seq::pointer pattern = perf().loop(s);          /* can be null  */
+            if (pb->rebind(s, snstring, hotkey, pattern))
+            {
+                pb->setEnabled(perf().is_screenset_active(s));
+                setup_button(pb);
+            }
+            else
+            {
+                int row, column;
+                if (perf().seq_to_grid(s, row, column, is_external()))
+                {
+                    (void) delete_slot(row, column);
+                    m_loop_buttons[seqno] = nullptr;
+                    delete pb;
+                    m_loop_buttons[seqno] = create_one_button(s);
+                }
+            }
+        }
+        set_needs_update();
+    }
+    return result;
+}
+
+/**
+ *  Switching banks rebinds the slot-buttons to the patterns of the new set.
+ *  The buttons are never deleted out from under the timer, so it need not be
+ *  stopped.  Only if the buttons do not exist yet are they recreated.
  */
 
 void
 qslivegrid::update_bank (int bankid)
 {
-    m_timer->stop();
     qslivebase::update_bank(bankid);
-    (void) recreate_all_slots();        /* sets m_redraw_buttons to true    */
-    m_timer->start();
+    if (! rebind_all_slots())
+        (void) recreate_all_slots();    /* sets m_redraw_buttons to true    */
 }
 
 void
 qslivegrid::update_bank ()
 {
-    m_timer->stop();
-    (void) recreate_all_slots();        /* sets m_redraw_buttons to true    */
-    m_timer->start();
+    if (! rebind_all_slots())
+        (void) recreate_all_slots();    /* sets m_redraw_buttons to true    */
 }
 
 /**
@@ -117,6 +117,48 @@ qslotbutton::setup ()
     setText(qt(snstring));
 }
 
+/**
+ *  Points this button at another slot, so that a screen-set change can reuse
+ *  the button instead of deleting it and creating a new one.  An empty slot
+ *  button can be rebound only to another empty slot.
+ *
+ * \param slotnumber
+ *      The new slot number.
+ *
+ * \param label
+ *      The new label, normally the slot number as a string.
+ *
+ * \param hotkey
+ *      The new hot-key for the slot.
+ *
+ * \param seqp
+ *      The pattern in the new slot.  Must be null for this class.
+ *
+ * \return
+ *      Returns true if the button was rebound.  Otherwise the caller must
+ *      replace the button with one of the other kind.
+ */
+
+bool
+qslotbutton::rebind
+(
+    seq::number slotnumber,
+    const std::string & label,
+    const std::string & hotkey,
+    seq::pointer seqp
+)
+{
+    bool result = ! seqp;
+    if (result)
+    {
+        m_slot_number = slotnumber;
+        m_label = label;
+        m_hotkey = hotkey;
+        set_dirty(true);
+    }
+    return result;
+}
+
 }           // namespace seq66
 
 /*
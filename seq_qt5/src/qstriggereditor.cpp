@@ -210,12 +210,15 @@ qstriggereditor::paintEvent (QPaintEvent *)
     pen.setStyle(Qt::SolidLine);
     brush.setStyle(Qt::SolidPattern);
     track().draw_lock();
-    for (auto cev = track().cbegin(); ! track().cend(cev); ++cev)
+    for (auto cev = track().cbegin(starttick); ! track().cend(cev); ++cev)
     {
         if (! track().get_next_event_match(m_status, m_cc, cev))
             break;
 
         midipulse tick = cev->timestamp();
+        if (tick > endtick)
+            break;                                  /* events are sorted    */
+
         bool selected = cev->is_selected();
         if ((tick >= starttick && tick <= endtick))
         {
@@ -33,10 +33,12 @@
  */
 
 #include <QApplication>                 /* QApplication etc.                */
+#include <QStatusBar>                   /* QStatusBar, for log messages     */
 #include <QTimer>                       /* QTimer                           */
 #include <QFile>
 
 #include "cfg/settings.hpp"             /* seq66::usr() and seq66::rc()     */
+#include "util/asynclog.hpp"            /* seq66::log_sink()                */
 #include "util/strfunctions.hpp"        /* seq66::string_replace()          */
 #include "gui_palette_qt5.hpp"          /* seq66::gui_palette_qt5           */
 #include "os/daemonize.hpp"             /* seq66::session_restart() check   */
@@ -52,6 +54,12 @@
 namespace seq66
 {
 
+/**
+ *  How long a log message stays in the status bar of the main window.
+ */
+
+static const int c_log_message_ms = 5000;
+
 /*
  *-------------------------------------------------------------------------
  * qt5nsmanager
@@ -80,10 +88,23 @@ qt5nsmanager::qt5nsmanager
 #if defined QT_VERSION_STR
     set_qt_version(std::string(QT_VERSION_STR));
 #endif
+
+    /*
+     * The log messages can arrive in the log's writer thread, so they are
+     * always queued to the GUI thread.
+     */
+
+    connect
+    (
+        this, SIGNAL(signal_log_message(const QString &)),
+        this, SLOT(show_log_message(const QString &)),
+        Qt::QueuedConnection
+    );
 }
 
 qt5nsmanager::~qt5nsmanager ()
 {
+    log_sink(nullptr);                  /* the sink calls this object       */
     if (not_nullptr(m_timer))
         m_timer->stop();
 
@@ -298,6 +319,26 @@ qt5nsmanager::detach_session (std::string & msg, bool ok)
 
 #endif
 
+/**
+ *  Passes a log message to the session manager, then to the GUI thread to
+ *  show in the status bar of the main window.  Called in the log's writer
+ *  thread, or the main thread.
+ */
+
+void
+qt5nsmanager::log_to_session (msglevel lev, const std::string & text)
+{
+    clinsmanager::log_to_session(lev, text);
+    emit signal_log_message(qt(text));
+}
+
+void
+qt5nsmanager::show_log_message (const QString & text)
+{
+    if (m_window)
+        m_window->statusBar()->showMessage(text, c_log_message_ms);
+}
+
 bool
 qt5nsmanager::run ()
 {
@@ -160,6 +160,15 @@ public:
     virtual void api_set_ppqn (int ppqn) = 0;
     virtual void api_set_beats_per_minute (midibpm bpm) = 0;
 
+    /**
+     *  Only midi_in_jack timestamps its input events at present.
+     */
+
+    virtual long api_input_age_us (midipulse /*stamp*/)
+    {
+        return 0;
+    }
+
     /*
      * The next two functions are provisional.  Currently useful only in the
      * midi_jack module.
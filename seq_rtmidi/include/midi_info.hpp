@@ -54,6 +54,7 @@
  *  An alternate name for this class could be "midi_master".  :-)
  */
 
+#include "midi/midithru.hpp"            /* seq66::midithru routes table     */
 #include "rterror.hpp"                  /* seq66::rterror exception class   */
 #include "rtmidi_types.hpp"             /* seq66::rtmidi_api, midi_message  */
 
@@ -386,6 +387,14 @@ protected:
 
     std::string m_error_string;
 
+    /**
+     *  The direct thru routes, owned by the mastermidibus.  Set in api_init()
+     *  before the engine is activated.  Only JACK applies them, in its
+     *  process callback.
+     */
+
+    const midithru * m_midi_thru;
+
 public:
 
     midi_info () = delete;
@@ -419,6 +428,16 @@ public:
         return m_midi_handle;
     }
 
+    const midithru * midi_thru () const
+    {
+        return m_midi_thru;
+    }
+
+    void midi_thru (const midithru * mt)
+    {
+        m_midi_thru = mt;
+    }
+
     midi_port_info & input_ports ()
     {
         return m_input;
@@ -248,6 +248,7 @@ public:
 
     virtual int api_poll_for_midi () override;
     virtual bool api_get_midi_event (event *) override;
+    virtual long api_input_age_us (midipulse stamp) override;
 
 private:
 
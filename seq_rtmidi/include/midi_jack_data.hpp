@@ -119,6 +119,14 @@ class midi_jack_data
 
     jack_time_t m_jack_lasttime;
 
+    /**
+     *  For an output port, the frame offset of the last event written to the
+     *  port buffer in the current process cycle.  JACK rejects events earlier
+     *  than the last one, so the direct thru events are written no earlier.
+     */
+
+    jack_nframes_t m_jack_last_offset;
+
 #if defined SEQ66_MIDI_PORT_REFRESH
 
     /**
@@ -368,6 +376,16 @@ public:
         m_jack_lasttime = jt;
     }
 
+    jack_nframes_t jack_last_offset () const
+    {
+        return m_jack_last_offset;
+    }
+
+    void jack_last_offset (jack_nframes_t offset)
+    {
+        m_jack_last_offset = offset;
+    }
+
 #if defined SEQ66_MIDI_PORT_REFRESH
 
     jack_port_id_t internal_port_id () const
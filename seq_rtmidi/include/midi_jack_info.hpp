@@ -87,6 +87,14 @@ private:
 
     portlist m_jack_ports;
 
+    /**
+     *  Maps an output buss index to its JACK port, for the direct thru
+     *  routes.  Filled in by api_connect(), before the client is activated,
+     *  so that the process callback need not search m_jack_ports.
+     */
+
+    midi_jack * m_thru_outputs[c_busscount_max];
+
     /**
      *  Holds the JACK sequencer client pointer so that it can be used
      *  by the midibus objects.  This is actually an opaque pointer; there is
@@ -146,6 +154,15 @@ public:
         return int(m_jack_sample_rate);
     }
 
+    /**
+     *  The output port of a buss, for the direct thru routes, or null.
+     */
+
+    midi_jack * thru_output (bussbyte bus) const
+    {
+        return bus < c_busscount_max ? m_thru_outputs[bus] : nullptr ;
+    }
+
     virtual bool api_get_midi_event (event * inev) override;
     virtual bool api_connect () override;
     virtual int api_poll_for_midi () override;
@@ -233,6 +250,8 @@ private:
         return int(m_jack_ports.size());
     }
 
+    void setup_thru_outputs ();
+
     /**
      *  Adds a pointer to a JACK port.
      */
@@ -0,0 +1,196 @@
+#if ! defined SEQ66_MIDI_NULL_HPP
+#define SEQ66_MIDI_NULL_HPP
+
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          midi_null.hpp
+ *
+ *  This module declares the in-process "null" MIDI I/O ports.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  The output port records what it is given in the capture log of the
+ *  midi_null_info object.  The input port delivers the scripted events for
+ *  its buss when they fall due.  See midi_null_info.hpp.
+ */
+
+#include "midi_api.hpp"                 /* seq66::midi_api base class       */
+#include "midi_null_info.hpp"           /* seq66::midi_null_info            */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+    class event;
+    class midibus;
+
+/**
+ *  This class implements the null version of the midi_api.  The output
+ *  functions are here, as in midi_alsa; the input functions do nothing
+ *  except in midi_in_null.
+ */
+
+class midi_null : public midi_api
+{
+
+private:
+
+    /**
+     *  The elapsed time of the first clock since the last start, stop,
+     *  continue, or tempo change, or -1 if there is none yet.  The due time
+     *  of each later clock is figured from it.
+     */
+
+    long m_clock_base_us;
+
+    /**
+     *  The pulse of that first clock.
+     */
+
+    midipulse m_clock_base_tick;
+
+    /**
+     *  The tempo in force at that first clock.
+     */
+
+    midibpm m_clock_bpm;
+
+public:
+
+    midi_null (midibus & parentbus, midi_info & masterinfo);
+    virtual ~midi_null ();
+
+protected:
+
+    midi_null_info & null_info ()
+    {
+        return static_cast<midi_null_info &>(master_info());
+    }
+
+    void capture
+    (
+        midipulse tick, long dueus,
+        midibyte st, midibyte d0 = 0, midibyte d1 = 0, int count = 1
+    );
+
+    virtual bool api_init_out () override;
+    virtual bool api_init_in () override;
+    virtual bool api_init_out_sub () override;
+    virtual bool api_init_in_sub () override;
+    virtual bool api_deinit_out () override;
+    virtual bool api_deinit_in () override;
+
+    virtual bool api_get_midi_event (event *) override
+    {
+        return false;
+    }
+
+    virtual int api_poll_for_midi () override
+    {
+        return 0;
+    }
+
+    virtual void api_play (const event * e24, midibyte channel) override;
+    virtual void api_sysex (const event * e24) override;
+    virtual void api_continue_from (midipulse tick, midipulse beats) override;
+    virtual void api_start () override;
+    virtual void api_stop () override;
+    virtual void api_clock (midipulse tick) override;
+
+    virtual void api_flush () override
+    {
+        // Nothing is buffered
+    }
+
+    virtual void api_set_ppqn (int /* ppqn */) override
+    {
+        // The midi_null_info object holds the PPQN
+    }
+
+    virtual void api_set_beats_per_minute (midibpm /* bpm */) override
+    {
+        // The midi_null_info object holds the BPM
+    }
+
+};          // class midi_null
+
+/**
+ *  This class implements the null version of a MIDI input object.
+ */
+
+class midi_in_null final : public midi_null
+{
+
+private:
+
+    /**
+     *  The scripted events for this buss, taken from the midi_null_info
+     *  object when the port is initialized.  Used only by the input thread.
+     */
+
+    midi_null_info::records m_script;
+
+    /**
+     *  The index of the next event to deliver.
+     */
+
+    size_t m_next;
+
+public:
+
+    midi_in_null (midibus & parentbus, midi_info & masterinfo);
+
+    virtual bool api_init_in () override;
+    virtual bool api_init_in_sub () override;
+    virtual int api_poll_for_midi () override;
+    virtual bool api_get_midi_event (event * inev) override;
+    virtual long api_input_age_us (midipulse stamp) override;
+
+};          // class midi_in_null
+
+/**
+ *  This class implements the null version of a MIDI output object.
+ */
+
+class midi_out_null final : public midi_null
+{
+
+public:
+
+    midi_out_null (midibus & parentbus, midi_info & masterinfo);
+
+};          // class midi_out_null
+
+}           // namespace seq66
+
+#endif      // SEQ66_MIDI_NULL_HPP
+
+/*
+ * midi_null.hpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
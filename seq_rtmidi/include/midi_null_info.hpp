@@ -0,0 +1,183 @@
+#if ! defined SEQ66_MIDI_NULL_INFO_HPP
+#define SEQ66_MIDI_NULL_INFO_HPP
+
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          midi_null_info.hpp
+ *
+ *    A class for holding the state of the in-process "null" MIDI API.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       See above.
+ *
+ *    The null API needs no MIDI server.  It has no system ports, so only
+ *    virtual ports are made.  What the output ports are given to send is
+ *    recorded, with timestamps, in a capture log held here.  The input
+ *    ports play back a script of events, each due a given number of
+ *    microseconds after the ports are activated.  It is meant for testing
+ *    and benchmarking on machines with neither ALSA nor JACK running.
+ *
+ *    Where the time an event should have been sent or received is known,
+ *    its record also holds that time, so that latency and jitter can be
+ *    figured:
+ *
+ *      -   Output: MIDI clocks, which are due at a fixed rate set by the
+ *          tempo and PPQN.  So a buss must have its clock enabled to yield
+ *          output figures.
+ *      -   Input: each scripted event, which is due at its scripted time,
+ *          and is logged when the input thread picks it up.
+ */
+
+#include <atomic>                       /* std::atomic<>                    */
+#include <mutex>                        /* std::mutex                       */
+#include <vector>                       /* std::vector<>                    */
+
+#include "midi_info.hpp"                /* seq66::midi_port_info etc.       */
+
+/*
+ * Do not document the namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  The class for the null MIDI API.
+ */
+
+class midi_null_info final : public midi_info
+{
+
+public:
+
+    /**
+     *  One event captured from an output port, or scripted for (and later
+     *  delivered by) an input port.  Times are in microseconds from the
+     *  activation of the ports.
+     */
+
+    struct record
+    {
+        long nr_us;             /**< When it was sent or delivered.         */
+        long nr_due_us;         /**< When it was due, or -1 if not known.   */
+        midipulse nr_tick;      /**< The pulse of the event, or -1.         */
+        int nr_buss;            /**< The buss number of the port.           */
+        bool nr_input;          /**< An input event, not an output event.   */
+        int nr_count;           /**< The number of bytes, 1 to 3.           */
+        midibyte nr_bytes[3];   /**< Status and data bytes.                 */
+    };
+
+    using records = std::vector<record>;
+
+private:
+
+    /**
+     *  The events sent to the output ports and delivered by the input
+     *  ports, in the order they occurred.  Space is reserved up front so
+     *  that logging does not usually allocate.
+     */
+
+    records m_capture;
+
+    /**
+     *  Guards m_capture, which the output, input, and main threads add to.
+     */
+
+    mutable std::mutex m_capture_mutex;
+
+    /**
+     *  The scripted input events, sorted by due time.  Filled from the file
+     *  named by rc().null_midi_script(), and by inject(), before the input
+     *  ports are made.  Read-only afterwards.
+     */
+
+    records m_script;
+
+    /**
+     *  The microtime() at which the ports were activated, the zero point of
+     *  all of the times in the records.
+     */
+
+    std::atomic<long> m_start_us;
+
+public:
+
+    midi_null_info () = delete;
+    midi_null_info (const std::string & appname, int ppqn, midibpm bpm);
+    virtual ~midi_null_info ();
+
+    /**
+     *  Each input port hands over its own events; see midi_in_null.
+     */
+
+    virtual bool api_get_midi_event (event *) override
+    {
+        return false;
+    }
+
+    virtual int api_poll_for_midi () override
+    {
+        return 0;
+    }
+
+    virtual void api_flush () override
+    {
+        // Nothing is buffered
+    }
+
+    virtual bool api_connect () override;
+
+    long start_us () const
+    {
+        return m_start_us;
+    }
+
+    long elapsed_us () const;
+    void capture (const record & r);
+    records captured () const;
+    bool inject (int buss, long us, const midibyte * bytes, int count);
+    bool load_script (const std::string & filename);
+    records script (int buss) const;
+    std::string statistics () const;
+    bool write_log (const std::string & filename) const;
+
+private:
+
+    virtual int get_all_port_info
+    (
+        midi_port_info & inports,
+        midi_port_info & outports
+    ) override;
+
+};          // class midi_null_info
+
+}           // namespace seq66
+
+#endif      // SEQ66_MIDI_NULL_INFO_HPP
+
+/*
+ * midi_null_info.hpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -120,6 +120,7 @@ protected:
     virtual bool api_deinit_in () override;
     virtual bool api_get_midi_event (event * inev) override;
     virtual int api_poll_for_midi () override;
+    virtual long api_input_age_us (midipulse stamp) override;
     virtual void api_continue_from (midipulse tick, midipulse beats) override;
     virtual void api_start () override;
     virtual void api_stop () override;
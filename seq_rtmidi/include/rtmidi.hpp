@@ -164,6 +164,11 @@ public:
         return get_api()->api_poll_for_midi();
     }
 
+    virtual long api_input_age_us (midipulse stamp) override
+    {
+        return get_api()->api_input_age_us(stamp);
+    }
+
     virtual void api_sysex (const event * e24) override
     {
         get_api()->api_sysex(e24);
@@ -167,6 +167,11 @@ public:
         get_api_info()->add_bus(m);
     }
 
+    void midi_thru (const midithru * mt)
+    {
+        get_api_info()->midi_thru(mt);
+    }
+
     /**
      *  Gets the buss/client ID for a MIDI interfaces.  This is the left-hand
      *  side of a X:Y pair (such as 128:0).
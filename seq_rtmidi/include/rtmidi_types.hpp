@@ -74,6 +74,7 @@ enum class rtmidi_api
     unspecified,        /**< Search for a working compiled API.     */
     alsa,               /**< Advanced Linux Sound Architecture API. */
     jack,               /**< JACK Low-Latency MIDI Server API.      */
+    null,               /**< In-process capture/script, no server.  */
 
 #if defined SEQ66_USE_RTMIDI_API_ALL
 
@@ -47,6 +47,8 @@ HEADERS += \
  include/midi_jack.hpp \
  include/midi_jack_data.hpp \
  include/midi_jack_info.hpp \
+ include/midi_null.hpp \
+ include/midi_null_info.hpp \
  include/midi_probe.hpp \
  include/rterror.hpp \
  include/rtmidi.hpp \
@@ -66,6 +68,8 @@ SOURCES += \
  src/midi_jack.cpp \
  src/midi_jack_data.cpp \
  src/midi_jack_info.cpp \
+ src/midi_null.cpp \
+ src/midi_null_info.cpp \
  src/midi_probe.cpp \
  src/rtmidi.cpp \
  src/rtmidi_info.cpp \
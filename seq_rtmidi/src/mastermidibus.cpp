@@ -62,10 +62,11 @@ mastermidibus::mastermidibus (int ppqn, midibpm bpm) :
     mastermidibase      (ppqn, bpm),
     m_midi_master                                           /* rtmidi_info  */
     (
-        rc().with_jack_midi() ? rtmidi_api::jack : rtmidi_api::alsa,
+        rc().with_null_midi() ? rtmidi_api::null :
+            (rc().with_jack_midi() ? rtmidi_api::jack : rtmidi_api::alsa),
         rc().app_client_name(), ppqn, bpm
     ),
-    m_use_jack_polling  (rc().with_jack_midi())
+    m_use_jack_polling  (rc().with_jack_midi() && ! rc().with_null_midi())
 {
     // Empty body
 }
@@ -86,7 +87,9 @@ mastermidibus::~mastermidibus ()
  *  output ports and one virtual input port are created.  They are given names
  *  that make it clear which application (seq66) has set them up.  They are
  *  not connected to anything.  The user will have to use a connection GUI
- *  (such as qjackctl) or a session manager to make the connections.
+ *  (such as qjackctl) or a session manager to make the connections.  The
+ *  null API (see midi_null_info) has no system ports, so it always works
+ *  this way.
  *
  *  Otherwise, the system MIDI input and output ports are scanned (via the
  *  rtmidi_info member) and passed to the midibus constructor calls.  For
@@ -132,7 +135,9 @@ mastermidibus::api_init (int ppqn, midibpm bpm)
 {
     midi_master().api_set_ppqn(ppqn);
     midi_master().api_set_beats_per_minute(bpm);
-    if (rc().manual_ports())                            /* virtual ports    */
+    midi_master().midi_thru(&midi_thru());              /* before activate  */
+    bool nullapi = midi_master().selected_api() == rtmidi_api::null;
+    if (rc().manual_ports() || nullapi)                 /* virtual ports    */
     {
         int num_buses = rc().manual_port_count();       /* output count     */
         midi_master().clear();
@@ -254,7 +254,8 @@ midi_info::midi_info (const std::string & appname, int ppqn, midibpm bpm) :
     m_ppqn              (ppqn),
     m_bpm               (bpm),
     m_midi_port_refresh (false),
-    m_error_string      ()
+    m_error_string      (),
+    m_midi_thru         (nullptr)
 {
     // No code
 }
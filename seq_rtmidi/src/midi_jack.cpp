@@ -299,27 +299,21 @@ jack_process_rtmidi_input (jack_nframes_t framect, void * arg)
     void * buf = ::jack_port_get_buffer(jackdata->jack_port(), framect);
     int evcount = ::jack_midi_get_event_count(buf);
     bool overflow = false;
+    jack_nframes_t cycleframe = ::jack_last_frame_time(jackdata->jack_client());
     for (int j = 0; j < evcount; ++j)
     {
         jack_midi_event_t jmevent;
         int rc = ::jack_midi_event_get(&jmevent, buf, j);
         if (rc == 0)                                /* ENODATA if buf empty */
         {
-            jack_time_t jtime = ::jack_get_time();  /* time in microsec (!) */
-            jack_time_t delta_jtime;                /* uint64_t             */
-            if (rtindata->first_message())
-            {
-                rtindata->first_message(false);
-                delta_jtime = 0;
-            }
-            else
-            {
-                jtime -= jackdata->jack_lasttime();
-                delta_jtime = jack_time_t(jtime * 0.000001);    /* secs???  */
-            }
-            jackdata->jack_lasttime(jtime);
+            /*
+             * The timestamp is the JACK frame at which the event arrived.
+             * It lets busarray::get_midi_event() merge the input ports in
+             * order of arrival.  It wraps around at 32 bits.
+             */
 
-            midi_message message(delta_jtime);      /* issue #100           */
+            jack_nframes_t arrival = cycleframe + jmevent.time;
+            midi_message message(midipulse(arrival));   /* issue #100       */
             size_t eventsize = jmevent.size;
             for (size_t i = 0; i < eventsize; ++i)
                 message.push(jmevent.buffer[i]);
@@ -561,6 +555,15 @@ jack_process_rtmidi_output (jack_nframes_t framect, void * arg)
         );
         if (destsz > 0 && valid_frame_offset(offset))
         {
+            /*
+             * JACK rejects an event earlier than the previous one in the
+             * buffer.  Clock pulses carry their own ticks, and are queued
+             * after the notes of the same cycle, so keep the order.
+             */
+
+            if (offset < lastvalue)
+                offset = lastvalue;
+
             const jack_midi_data_t * data =
                 reinterpret_cast<const jack_midi_data_t *>(mbuf);
 
@@ -575,6 +578,7 @@ jack_process_rtmidi_output (jack_nframes_t framect, void * arg)
         else
             break;
     }
+    jackdata->jack_last_offset(lastvalue);          /* for direct thru      */
     return 0;
 }
 
@@ -591,6 +595,7 @@ jack_process_rtmidi_output (jack_nframes_t framect, void * arg)
     char * sp = reinterpret_cast<char *>(&space);
     void * buf = ::jack_port_get_buffer(jackport, framect);
     ::jack_midi_clear_buffer(buf);                  /* no nullptr test      */
+    jackdata->jack_last_offset(0);                  /* all events at 0      */
     for (;;)
     {
         size_t msgsz = ::jack_ringbuffer_read_space(buffmsg);
@@ -1853,7 +1858,6 @@ int
 midi_in_jack::api_poll_for_midi ()
 {
     rtmidi_in_data * rtindata = jack_data().jack_rtmidiin();
-    (void) microsleep(std_sleep_us());
     return rtindata->queue().count();
 }
 
@@ -1937,6 +1941,37 @@ midi_in_jack::api_get_midi_event (event * inev)
     return result;
 }
 
+/**
+ *  Calculates how long ago an input event arrived.  The process callback
+ *  stamps each incoming message with the JACK frame at which it arrived
+ *  (jack_last_frame_time() plus the offset of the event in the cycle), so
+ *  the age is the distance to the current estimated frame.  Unsigned
+ *  arithmetic handles the wraparound of the 32-bit frame counter.
+ *
+ * \param stamp
+ *      The frame timestamp of the event, as stored in the event.
+ *
+ * \return
+ *      Returns the age of the event in microseconds.  If there is no client,
+ *      or the age is implausibly large (over a second), 0 is returned, and
+ *      no compensation is made.
+ */
+
+long
+midi_in_jack::api_input_age_us (midipulse stamp)
+{
+    long result = 0;
+    jack_client_t * client = client_handle();
+    if (not_nullptr(client))
+    {
+        jack_nframes_t rate = ::jack_get_sample_rate(client);
+        jack_nframes_t age = ::jack_frame_time(client) - jack_nframes_t(stamp);
+        if (rate > 0 && age <= rate)
+            result = long(double(age) * 1000000.0 / double(rate));
+    }
+    return result;
+}
+
 /**
  *  Destructor.  Currently the base class closes the port, closes the JACK
  *  client, and cleans up the API data structure.
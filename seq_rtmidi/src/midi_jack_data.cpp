@@ -73,6 +73,7 @@ midi_jack_data::midi_jack_data () :
     m_jack_buffmessage      (nullptr),
 #endif
     m_jack_lasttime         (0),
+    m_jack_last_offset      (0),
 #if defined SEQ66_MIDI_PORT_REFRESH
     m_internal_port_id      (null_system_port_id()),
 #endif
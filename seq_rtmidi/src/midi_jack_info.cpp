@@ -38,6 +38,8 @@
 
 #if defined SEQ66_JACK_SUPPORT
 
+#include <jack/midiport.h>              /* jack_midi_event_write(), etc.    */
+
 #if defined SEQ66_JACK_METADATA
 #include <jack/metadata.h>
 #include "base64_images.hpp"
@@ -83,6 +85,83 @@ extern void jack_port_register_callback
     jack_port_id_t port, int ev_value, void * arg
 );
 
+/**
+ *  Applies the direct thru routes to the events that arrived on a JACK input
+ *  port in this cycle.  Each routed event is written to the buffer of its
+ *  output port at its arrival offset, or after the last event already in that
+ *  buffer, so it goes out in the same cycle, without waiting for the input
+ *  and output threads.  Must be called after the output ports have been
+ *  processed, since that clears their buffers.
+ *
+ * \param self
+ *      The midi_jack_info object, which holds the output port of each buss.
+ *
+ * \param mt
+ *      The routes.
+ *
+ * \param nframes
+ *      The frame count of the cycle.
+ *
+ * \param in
+ *      The input port.
+ */
+
+static void
+jack_process_thru
+(
+    const midi_jack_info & self,
+    const midithru & mt,
+    jack_nframes_t nframes,
+    midi_jack * in
+)
+{
+    bussbyte inbus = bussbyte(in->parent_bus().bus_index());
+    void * inbuf = ::jack_port_get_buffer(in->jack_data().jack_port(), nframes);
+    int evcount = ::jack_midi_get_event_count(inbuf);
+    for (int j = 0; j < evcount; ++j)
+    {
+        jack_midi_event_t jmevent;
+        if (::jack_midi_event_get(&jmevent, inbuf, j) != 0)
+            continue;
+
+        int len = int(jmevent.size);
+        if (len < 1 || len > 3)                     /* channel messages     */
+            continue;
+
+        midibyte status = midibyte(jmevent.buffer[0]);
+        for (int r : mt.lookup(inbus, status))
+        {
+            const midithru::route & rt = mt.at(r);
+            midibyte msg[3];
+            for (int i = 0; i < len; ++i)
+                msg[i] = midibyte(jmevent.buffer[i]);
+
+            if (mt.apply(rt, inbus, msg, len))
+            {
+                midi_jack * out = self.thru_output(rt.mtr_out_buss);
+                if (not_nullptr(out) && out->enabled())
+                {
+                    midi_jack_data & od = out->jack_data();
+                    jack_port_t * port = od.jack_port();
+                    void * outbuf = ::jack_port_get_buffer(port, nframes);
+                    jack_nframes_t offset = jmevent.time;
+                    if (offset < od.jack_last_offset())
+                        offset = od.jack_last_offset();
+
+                    int rc = ::jack_midi_event_write
+                    (
+                        outbuf, offset, msg, size_t(len)
+                    );
+                    if (rc == 0)
+                        od.jack_last_offset(offset);
+                    else
+                        async_safe_errprint("JACK MIDI thru write error");
+                }
+            }
+        }
+    }
+}
+
 /**
  *  Provides a JACK callback function that uses the callbacks defined in the
  *  midi_jack module.  This function calls both the input callback and
@@ -120,6 +199,16 @@ jack_process_io (jack_nframes_t nframes, void * arg)
                     (void) jack_process_rtmidi_output(nframes, mjp);
             }
         }
+
+        const midithru * mt = self->midi_thru();
+        if (not_nullptr(mt) && mt->active())
+        {
+            for (auto mj : self->jack_ports())      /* after outputs filled */
+            {
+                if (mj->enabled() && mj->parent_bus().is_input_port())
+                    jack_process_thru(*self, *mt, nframes, mj);
+            }
+        }
     }
     return 0;
 }
@@ -145,6 +234,7 @@ midi_jack_info::midi_jack_info
 ) :
     midi_info               (appname, ppqn, bpm),
     m_jack_ports            (),
+    m_thru_outputs          (),
     m_jack_client           (nullptr),              /* inited for connect() */
     m_jack_buffer_size      (0),
     m_jack_sample_rate      (0)
@@ -777,6 +867,31 @@ midi_jack_info::show_details () const
     }
 }
 
+/**
+ *  Fills in the output port of each buss for the direct thru routes.  All
+ *  ports exist by the time api_connect() is called, and the table is then
+ *  only read by the process callback, which checks that the port is still
+ *  enabled.
+ */
+
+void
+midi_jack_info::setup_thru_outputs ()
+{
+    for (auto & out : m_thru_outputs)
+        out = nullptr;
+
+    for (auto mj : m_jack_ports)
+    {
+        const midibus & mb = mj->parent_bus();
+        int bus = mb.bus_index();
+        if (mb.is_output_port() && bus >= 0 && bus < c_busscount_max)
+        {
+            if (is_nullptr(m_thru_outputs[bus]))
+                m_thru_outputs[bus] = mj;
+        }
+    }
+}
+
 /**
  *  Sets up all of the I/O ports, represented by midibus objects, that have
  *  been created.
@@ -800,6 +915,7 @@ midi_jack_info::api_connect ()
     if (result)
     {
         m_jack_buffer_size = ::jack_get_buffer_size(client_handle());
+        setup_thru_outputs();
 
         int rcode = ::jack_activate(client_handle());
         result = rcode == 0;
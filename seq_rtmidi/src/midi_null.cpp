@@ -0,0 +1,359 @@
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          midi_null.cpp
+ *
+ *  This module defines the in-process "null" MIDI I/O ports.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       GNU GPLv2 or above
+ *
+ *  The ports are always virtual; the midibus constructor has already named
+ *  them, so initializing a port just marks it open.  Nothing here blocks
+ *  except the brief lock taken to add to the capture log.
+ */
+
+#include "midi/event.hpp"               /* seq66::event and status tokens   */
+#include "midi_null.hpp"                /* seq66::midi_null etc.            */
+#include "os/timing.hpp"                /* seq66::microtime()               */
+
+/*
+ *  Do not document a namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  Input events older than this are not compensated for; see
+ *  api_input_age_us().
+ */
+
+static const long c_null_max_age_us = 1000000;
+
+/*
+ * class midi_null
+ */
+
+midi_null::midi_null (midibus & parentbus, midi_info & masterinfo) :
+    midi_api            (parentbus, masterinfo),
+    m_clock_base_us     (-1),
+    m_clock_base_tick   (0),
+    m_clock_bpm         (0.0)
+{
+    // Empty body
+}
+
+midi_null::~midi_null ()
+{
+    // Empty body
+}
+
+/**
+ *  Adds an output event to the capture log, stamped with the elapsed time.
+ *
+ * \param tick
+ *      The pulse of the event, as known, or -1.
+ *
+ * \param dueus
+ *      The elapsed time at which the event was due, or -1 if not known.
+ *
+ * \param st
+ *      The status byte.
+ *
+ * \param d0
+ *      The first data byte, if any.
+ *
+ * \param d1
+ *      The second data byte, if any.
+ *
+ * \param count
+ *      The number of bytes, 1 to 3.
+ */
+
+void
+midi_null::capture
+(
+    midipulse tick, long dueus,
+    midibyte st, midibyte d0, midibyte d1, int count
+)
+{
+    midi_null_info::record r;
+    r.nr_us = null_info().elapsed_us();
+    r.nr_due_us = dueus;
+    r.nr_tick = tick;
+    r.nr_buss = bus_index();
+    r.nr_input = false;
+    r.nr_count = count;
+    r.nr_bytes[0] = st;
+    r.nr_bytes[1] = d0;
+    r.nr_bytes[2] = d1;
+    null_info().capture(r);
+}
+
+bool
+midi_null::api_init_out ()
+{
+    set_port_open();
+    return true;
+}
+
+bool
+midi_null::api_init_in ()
+{
+    set_port_open();
+    return true;
+}
+
+bool
+midi_null::api_init_out_sub ()
+{
+    set_port_open();
+    return true;
+}
+
+bool
+midi_null::api_init_in_sub ()
+{
+    set_port_open();
+    return true;
+}
+
+bool
+midi_null::api_deinit_out ()
+{
+    return true;
+}
+
+bool
+midi_null::api_deinit_in ()
+{
+    return true;
+}
+
+/**
+ *  Logs a channel event.  The tick is the timestamp of the event, which is
+ *  relative to the start of its pattern, so no due time is known.
+ */
+
+void
+midi_null::api_play (const event * e24, midibyte channel)
+{
+    midibyte status = e24->get_status(channel);
+    midibyte d0, d1;
+    e24->get_data(d0, d1);
+    if (e24->is_two_bytes())
+        capture(e24->timestamp(), -1, status, d0, d1, 3);
+    else
+        capture(e24->timestamp(), -1, status, d0, 0, 2);
+}
+
+/**
+ *  Logs only the start of a SysEx message; the log holds short messages.
+ */
+
+void
+midi_null::api_sysex (const event * e24)
+{
+    capture(e24->timestamp(), -1, EVENT_MIDI_SYSEX);
+}
+
+/**
+ *  Logs a Song Position and a Continue, as midi_alsa sends them.
+ */
+
+void
+midi_null::api_continue_from (midipulse tick, midipulse beats)
+{
+    midibyte lsb = midibyte(beats & 0x7F);
+    midibyte msb = midibyte((beats >> 7) & 0x7F);
+    m_clock_base_us = -1;
+    capture(tick, -1, EVENT_MIDI_SONG_POS, lsb, msb, 3);
+    capture(tick, -1, EVENT_MIDI_CONTINUE);
+}
+
+void
+midi_null::api_start ()
+{
+    m_clock_base_us = -1;
+    capture(0, -1, EVENT_MIDI_START);
+}
+
+void
+midi_null::api_stop ()
+{
+    m_clock_base_us = -1;
+    capture(-1, -1, EVENT_MIDI_STOP);
+}
+
+/**
+ *  Logs a MIDI clock, with the time it was due.  Clocks come at a steady
+ *  rate, so the due time is that of the first clock since the transport or
+ *  tempo last changed, plus the time the pulses in between should take.
+ *  The first clock itself is taken to be on time.
+ *
+ * \param tick
+ *      The pulse of the clock, a multiple of PPQN / 24.
+ */
+
+void
+midi_null::api_clock (midipulse tick)
+{
+    long now = null_info().elapsed_us();
+    midibpm bpm = master_info().bpm();
+    int ppqn = master_info().ppqn();
+    long due = now;
+    bool rebase = m_clock_base_us < 0 || bpm != m_clock_bpm ||
+        tick < m_clock_base_tick || bpm <= 0.0 || ppqn <= 0;
+
+    if (rebase)
+    {
+        m_clock_base_us = now;
+        m_clock_base_tick = tick;
+        m_clock_bpm = bpm;
+    }
+    else
+    {
+        double uspertick = 60000000.0 / (bpm * ppqn);
+        due = m_clock_base_us + long((tick - m_clock_base_tick) * uspertick);
+    }
+    capture(tick, due, EVENT_MIDI_CLOCK);
+}
+
+/*
+ * class midi_in_null
+ */
+
+midi_in_null::midi_in_null (midibus & parentbus, midi_info & masterinfo) :
+    midi_null   (parentbus, masterinfo),
+    m_script    (),
+    m_next      (0)
+{
+    // Empty body
+}
+
+bool
+midi_in_null::api_init_in ()
+{
+    m_script = null_info().script(bus_index());
+    m_next = 0;
+    return midi_null::api_init_in();
+}
+
+bool
+midi_in_null::api_init_in_sub ()
+{
+    m_script = null_info().script(bus_index());
+    m_next = 0;
+    return midi_null::api_init_in_sub();
+}
+
+/**
+ *  Counts the scripted events that are due.
+ *
+ * \return
+ *      Returns the number of events that api_get_midi_event() would return
+ *      now.
+ */
+
+int
+midi_in_null::api_poll_for_midi ()
+{
+    long now = null_info().elapsed_us();
+    size_t index = m_next;
+    while (index < m_script.size() && m_script[index].nr_us <= now)
+        ++index;
+
+    return int(index - m_next);
+}
+
+/**
+ *  Hands over the next scripted event, if it is due, and logs it with the
+ *  time it was picked up.  The timestamp of the event is the microtime() at
+ *  which it was due, for api_input_age_us().
+ *
+ * \param inev
+ *      Provides the destination for the MIDI event.
+ *
+ * \return
+ *      Returns true if an event was obtained.
+ */
+
+bool
+midi_in_null::api_get_midi_event (event * inev)
+{
+    bool result = false;
+    if (m_next < m_script.size())
+    {
+        long now = null_info().elapsed_us();
+        midi_null_info::record r = m_script[m_next];
+        if (r.nr_us <= now)
+        {
+            long stamp = null_info().start_us() + r.nr_us;
+            ++m_next;
+            result = inev->set_midi_event(stamp, r.nr_bytes, r.nr_count);
+            r.nr_us = now;
+            null_info().capture(r);
+        }
+    }
+    return result;
+}
+
+/**
+ *  Calculates how long ago an input event was due, as midi_in_jack does
+ *  from its frame timestamps.
+ *
+ * \param stamp
+ *      The microtime() at which the event was due.
+ *
+ * \return
+ *      Returns the age in microseconds, or 0 if it is not plausible.
+ */
+
+long
+midi_in_null::api_input_age_us (midipulse stamp)
+{
+    long result = microtime() - long(stamp);
+    if (result < 0 || result > c_null_max_age_us)
+        result = 0;
+
+    return result;
+}
+
+/*
+ * class midi_out_null
+ */
+
+midi_out_null::midi_out_null (midibus & parentbus, midi_info & masterinfo) :
+    midi_null   (parentbus, masterinfo)
+{
+    // Empty body
+}
+
+}           // namespace seq66
+
+/*
+ * midi_null.cpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
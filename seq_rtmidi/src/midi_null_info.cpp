@@ -0,0 +1,491 @@
+/*
+ *  This file is part of seq66.
+ *
+ *  seq66 is free software; you can redistribute it and/or modify it under the
+ *  terms of the GNU General Public License as published by the Free Software
+ *  Foundation; either version 2 of the License, or (at your option) any later
+ *  version.
+ *
+ *  seq66 is distributed in the hope that it will be useful, but WITHOUT ANY
+ *  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ *  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ *  details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with seq66; if not, write to the Free Software Foundation, Inc., 59 Temple
+ *  Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * \file          midi_null_info.cpp
+ *
+ *    A class for holding the state of the in-process "null" MIDI API.
+ *
+ * \library       seq66 application
+ * \author        Chris Ahlstrom
+ * \date          2026-10-18
+ * \updates       2026-10-18
+ * \license       See above.
+ *
+ *  The input script is a text file with one event per line:
+ *
+ \verbatim
+        # microseconds  buss  status  data  data
+        500000          0     0x90    60    100
+        750000          0     0x80    60    0
+ \endverbatim
+ *
+ *  Numbers can be decimal or "0x" hexadecimal.  Text after a '#' is ignored.
+ *  The status byte determines how many data bytes are needed.
+ *
+ *  The capture log written at exit has the same layout, plus the due time
+ *  (or -1), the pulse (or -1), and the direction:
+ *
+ \verbatim
+        # us due tick dir buss bytes
+        1021 1000 96 out 0 0xf8
+ \endverbatim
+ */
+
+#include <algorithm>                    /* std::upper_bound()               */
+#include <cmath>                        /* std::sqrt()                      */
+#include <cstdio>                       /* std::snprintf()                  */
+#include <fstream>                      /* std::ifstream, std::ofstream     */
+#include <sstream>                      /* std::istringstream               */
+
+#include "cfg/settings.hpp"             /* seq66::rc() configuration object */
+#include "midi/event.hpp"               /* seq66::event and status tokens   */
+#include "midi_null_info.hpp"           /* seq66::midi_null_info            */
+#include "os/timing.hpp"                /* seq66::microtime()               */
+#include "util/basic_macros.hpp"        /* C++ version of easy macros       */
+
+/*
+ * Do not document the namespace; it breaks Doxygen.
+ */
+
+namespace seq66
+{
+
+/**
+ *  The number of records reserved for the capture log.  More are added as
+ *  needed, at the cost of an allocation in the thread doing the adding.
+ */
+
+static const size_t c_null_capture_reserve = 16384;
+
+/**
+ *  The number of data bytes needed by a status byte.  Only the short
+ *  messages are supported in the script; SysEx is refused by inject().
+ */
+
+static int
+data_byte_count (midibyte status)
+{
+    int result = 2;
+    if (status >= EVENT_MIDI_SYSEX)
+    {
+        if (status == EVENT_MIDI_SONG_POS)
+            result = 2;
+        else if (status == EVENT_MIDI_SONG_SELECT)
+            result = 1;
+        else if (status == EVENT_MIDI_QUARTER_FRAME)    /* MTC: 0nnn dddd   */
+            result = 1;
+        else
+            result = 0;
+    }
+    else
+    {
+        midibyte s = event::mask_status(status);
+        if (s == EVENT_PROGRAM_CHANGE || s == EVENT_CHANNEL_PRESSURE)
+            result = 1;
+    }
+    return result;
+}
+
+/**
+ *  Principal constructor.  There is no handle to a server, so the object
+ *  itself is the handle; rtmidi_info::set_api_info() requires one.  The
+ *  input script, if configured, is read here, so that it is ready when the
+ *  input ports are made.
+ */
+
+midi_null_info::midi_null_info
+(
+    const std::string & appname,
+    int ppqn,
+    midibpm bpm
+) :
+    midi_info       (appname, ppqn, bpm),
+    m_capture       (),
+    m_capture_mutex (),
+    m_script        (),
+    m_start_us      (microtime())
+{
+    m_capture.reserve(c_null_capture_reserve);
+    midi_handle(this);
+    global_queue(0);
+    if (! rc().null_midi_script().empty())
+        (void) load_script(rc().null_midi_script());
+
+    info_message("Null MIDI API in use; no MIDI is sent or received");
+}
+
+/**
+ *  Reports the latency and jitter figures, and writes the capture log if
+ *  one is configured.
+ */
+
+midi_null_info::~midi_null_info ()
+{
+    std::string stats = statistics();
+    if (! stats.empty())
+        info_message(stats);
+
+    if (! rc().null_midi_log().empty())
+        (void) write_log(rc().null_midi_log());
+}
+
+/**
+ *  Called when the master buss is activated, after all ports are made.
+ *  This is time zero for the script and the capture log.
+ */
+
+bool
+midi_null_info::api_connect ()
+{
+    m_start_us = microtime();
+    return true;
+}
+
+long
+midi_null_info::elapsed_us () const
+{
+    return microtime() - m_start_us;
+}
+
+void
+midi_null_info::capture (const record & r)
+{
+    std::lock_guard<std::mutex> lock(m_capture_mutex);
+    m_capture.push_back(r);
+}
+
+/**
+ *  Returns a copy of the capture log, so that it can be examined while
+ *  ports are still adding to it.
+ */
+
+midi_null_info::records
+midi_null_info::captured () const
+{
+    std::lock_guard<std::mutex> lock(m_capture_mutex);
+    return m_capture;
+}
+
+/**
+ *  Adds an event to the input script.  Must be called before the input
+ *  ports are made, as they take their events when initialized.
+ *
+ * \param buss
+ *      The input buss to deliver the event.
+ *
+ * \param us
+ *      The due time, in microseconds from the activation of the ports.
+ *
+ * \param bytes
+ *      The status byte and data bytes.
+ *
+ * \param count
+ *      The number of bytes, 1 to 3.
+ *
+ * \return
+ *      Returns true if the event was valid and added.
+ */
+
+bool
+midi_null_info::inject (int buss, long us, const midibyte * bytes, int count)
+{
+    bool result = buss >= 0 && us >= 0 && count >= 1 && count <= 3;
+    if (result)
+        result = event::is_status(bytes[0]) &&
+            bytes[0] != EVENT_MIDI_SYSEX && bytes[0] != EVENT_MIDI_SYSEX_END;
+
+    if (result)
+    {
+        record r;
+        r.nr_us = us;
+        r.nr_due_us = us;
+        r.nr_tick = (-1);
+        r.nr_buss = buss;
+        r.nr_input = true;
+        r.nr_count = count;
+        for (int i = 0; i < 3; ++i)
+            r.nr_bytes[i] = i < count ? bytes[i] : 0 ;
+
+        auto pos = std::upper_bound
+        (
+            m_script.begin(), m_script.end(), r,
+            [] (const record & a, const record & b)
+            {
+                return a.nr_us < b.nr_us;
+            }
+        );
+        (void) m_script.insert(pos, r);
+    }
+    return result;
+}
+
+/**
+ *  Reads the input script.  See the banner for the format.  A bad line is
+ *  reported and skipped.
+ *
+ * \return
+ *      Returns true if the file could be opened and all lines were good.
+ */
+
+bool
+midi_null_info::load_script (const std::string & filename)
+{
+    std::ifstream file(filename);
+    bool result = file.is_open();
+    if (result)
+    {
+        std::string line;
+        int lineno = 0;
+        while (std::getline(file, line))
+        {
+            ++lineno;
+            std::string::size_type hash = line.find('#');
+            if (hash != std::string::npos)
+                line.erase(hash);
+
+            std::istringstream iss(line);
+            std::vector<long> values;
+            std::string token;
+            bool ok = true;
+            while (ok && (iss >> token))
+            {
+                try
+                {
+                    values.push_back(std::stol(token, nullptr, 0));
+                }
+                catch (const std::exception &)
+                {
+                    ok = false;
+                }
+            }
+            if (values.empty() && ok)
+                continue;                               /* blank or comment */
+
+            ok = ok && values.size() >= 3 && values.size() <= 5;
+            if (ok)
+            {
+                midibyte bytes[3] = { 0, 0, 0 };
+                int count = int(values.size()) - 2;
+                bytes[0] = midibyte(values[2]);
+                ok = count == 1 + data_byte_count(bytes[0]);
+                for (int i = 1; ok && i < count; ++i)
+                {
+                    ok = values[i + 2] >= 0 && values[i + 2] < 0x80;
+                    bytes[i] = midibyte(values[i + 2]);
+                }
+                if (ok)
+                    ok = inject(int(values[1]), values[0], bytes, count);
+            }
+            if (! ok)
+            {
+                std::string tag = "Bad null-MIDI script line ";
+                tag += std::to_string(lineno);
+                (void) file_error(tag, filename);
+                result = false;
+            }
+        }
+    }
+    else
+        (void) file_error("Cannot open null-MIDI script", filename);
+
+    return result;
+}
+
+/**
+ *  Returns the scripted events for one input buss, in due order.
+ */
+
+midi_null_info::records
+midi_null_info::script (int buss) const
+{
+    records result;
+    for (const auto & r : m_script)
+    {
+        if (r.nr_buss == buss)
+            result.push_back(r);
+    }
+    return result;
+}
+
+/**
+ *  Summarizes the lateness (time minus due time) of the timed records of
+ *  one direction.  The jitter is the standard deviation of the lateness.
+ *
+ * \return
+ *      Returns an empty string if there are no records.
+ */
+
+static std::string
+lateness_summary (const midi_null_info::records & recs, bool input)
+{
+    std::string result;
+    long count = 0;
+    long timed = 0;
+    long maxlate = 0;
+    double sum = 0.0;
+    double sumsq = 0.0;
+    for (const auto & r : recs)
+    {
+        if (r.nr_input != input)
+            continue;
+
+        ++count;
+        if (r.nr_due_us >= 0)
+        {
+            long late = r.nr_us - r.nr_due_us;
+            if (timed == 0 || late > maxlate)
+                maxlate = late;
+
+            ++timed;
+            sum += double(late);
+            sumsq += double(late) * double(late);
+        }
+    }
+    if (count > 0)
+    {
+        char temp[128];
+        if (timed > 0)
+        {
+            double mean = sum / double(timed);
+            double var = sumsq / double(timed) - mean * mean;
+            double jitter = var > 0.0 ? std::sqrt(var) : 0.0 ;
+            (void) snprintf
+            (
+                temp, sizeof temp,
+                "%s %ld events, %ld timed: latency %.1f us, "
+                "jitter %.1f us, max %ld us",
+                input ? "in" : "out", count, timed, mean, jitter, maxlate
+            );
+        }
+        else
+        {
+            (void) snprintf
+            (
+                temp, sizeof temp, "%s %ld events, none timed",
+                input ? "in" : "out", count
+            );
+        }
+        result = temp;
+    }
+    return result;
+}
+
+/**
+ *  Figures the latency and jitter of the output clocks and of the input
+ *  events.
+ *
+ * \return
+ *      Returns a one-line summary, or an empty string if nothing was
+ *      captured.
+ */
+
+std::string
+midi_null_info::statistics () const
+{
+    records recs = captured();
+    std::string result;
+    std::string out = lateness_summary(recs, false);
+    std::string in = lateness_summary(recs, true);
+    if (! out.empty() || ! in.empty())
+    {
+        result = "Null MIDI:";
+        if (! out.empty())
+            result += " " + out;
+
+        if (! in.empty())
+        {
+            if (! out.empty())
+                result += ";";
+
+            result += " " + in;
+        }
+    }
+    return result;
+}
+
+/**
+ *  Writes the capture log as text.  See the banner for the format.  The
+ *  summary from statistics() is written as a comment at the end.
+ */
+
+bool
+midi_null_info::write_log (const std::string & filename) const
+{
+    std::ofstream file(filename, std::ios::out | std::ios::trunc);
+    bool result = file.is_open();
+    if (result)
+    {
+        records recs = captured();
+        file << "# us due tick dir buss bytes\n";
+        for (const auto & r : recs)
+        {
+            char temp[96];
+            int n = snprintf
+            (
+                temp, sizeof temp, "%ld %ld %ld %s %d",
+                r.nr_us, r.nr_due_us, long(r.nr_tick),
+                r.nr_input ? "in" : "out", r.nr_buss
+            );
+            for (int i = 0; i < r.nr_count && n > 0; ++i)
+            {
+                n += snprintf
+                (
+                    temp + n, sizeof temp - size_t(n), " 0x%02x",
+                    unsigned(r.nr_bytes[i])
+                );
+            }
+            file << temp << "\n";
+        }
+        file << "# " << statistics() << "\n";
+        file_message("Wrote null-MIDI log", filename);
+    }
+    else
+        (void) file_error("Cannot write null-MIDI log", filename);
+
+    return result;
+}
+
+/**
+ *  There are no system ports.  The virtual ports are added by
+ *  mastermidibus::api_init().
+ *
+ * \return
+ *      Returns 0, the number of ports found.
+ */
+
+int
+midi_null_info::get_all_port_info
+(
+    midi_port_info & inports,
+    midi_port_info & outports
+)
+{
+    inports.clear();
+    outports.clear();
+    return 0;
+}
+
+}           // namespace seq66
+
+/*
+ * midi_null_info.cpp
+ *
+ * vim: sw=4 ts=4 wm=4 et ft=cpp
+ */
+
@@ -70,6 +70,7 @@ midi_api_name (int i)
         s_api_map[rtmidi_api::unspecified]  = "Unspecified";
         s_api_map[rtmidi_api::alsa]         = "ALSA";
         s_api_map[rtmidi_api::jack]         = "Jack";
+        s_api_map[rtmidi_api::null]         = "Null";
 
 #if defined SEQ66_USE_RTMIDI_API_ALL
         /*
@@ -246,6 +246,22 @@ midibus::api_get_midi_event (event * inev)
         return false;
 }
 
+/**
+ *  Gets the age of an input event from its arrival timestamp.
+ *
+ * \param stamp
+ *      The arrival timestamp set by the input API.
+ *
+ * \return
+ *      Returns the age in microseconds, or 0 if it cannot be determined.
+ */
+
+long
+midibus::api_input_age_us (midipulse stamp)
+{
+    return not_nullptr(m_rt_midi) ? m_rt_midi->api_input_age_us(stamp) : 0 ;
+}
+
 /**
  *  Initializes the MIDI output port.
  *
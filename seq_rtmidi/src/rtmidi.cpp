@@ -56,6 +56,8 @@
 #include "midi_alsa.hpp"
 #endif
 
+#include "midi_null.hpp"                    /* always available             */
+
 /*
  * Do not document the namespace; it breaks Doxygen.
  */
@@ -216,7 +218,19 @@ rtmidi_in::openmidi_api (rtmidi_api api, rtmidi_info & info)
     {
         midi_info & midiinfo = *(info.get_api_info());
         delete_api();
-        if (api == rtmidi_api::unspecified)
+        if (api == rtmidi_api::null)
+        {
+            midi_in_null * minp = new (std::nothrow) midi_in_null
+            (
+                parent_bus(), midiinfo
+            );
+            if (not_nullptr(minp))
+            {
+                set_api(minp);
+                got_an_api = true;
+            }
+        }
+        else if (api == rtmidi_api::unspecified)
         {
             if (rc().with_jack_midi())
             {
@@ -381,7 +395,19 @@ rtmidi_out::openmidi_api (rtmidi_api api, rtmidi_info & info)
     {
         midi_info & midiinfo = *(info.get_api_info());
         delete_api();
-        if (api == rtmidi_api::unspecified)
+        if (api == rtmidi_api::null)
+        {
+            midi_out_null * monp = new (std::nothrow) midi_out_null
+            (
+                parent_bus(), midiinfo
+            );
+            if (not_nullptr(monp))
+            {
+                set_api(monp);
+                got_an_api = true;
+            }
+        }
+        else if (api == rtmidi_api::unspecified)
         {
             if (rc().with_jack_midi())
             {
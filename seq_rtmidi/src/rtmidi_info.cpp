@@ -46,6 +46,8 @@
 #include "midi_jack_info.hpp"
 #endif
 
+#include "midi_null_info.hpp"               /* always available             */
+
 /*
  * Do not document the namespace; it breaks Doxygen.
  */
@@ -84,6 +86,11 @@ void
 rtmidi_info::get_compiled_api (rtmidi_api_list & apis)
 {
     apis.clear();
+    if (rc().with_null_midi())
+    {
+        apis.push_back(rtmidi_api::null);       /* needs no MIDI server     */
+        return;
+    }
 
     /*
      * The order here will control the order of rtmidi's API search in the
@@ -224,6 +231,18 @@ rtmidi_info::openmidi_api
 {
     bool result = false;
     delete_api();
+    if (api == rtmidi_api::null)
+    {
+        midi_null_info * mnip = new (std::nothrow) midi_null_info
+        (
+            appname, ppqn, bpm
+        );
+        result = not_nullptr(mnip);
+        if (result)
+            result = set_api_info(mnip);
+
+        return result;
+    }
 
 #if defined SEQ66_BUILD_UNIX_JACK
     if (api == rtmidi_api::jack)